@@ -0,0 +1,1391 @@
+//----------------------------------------------------------------------------
+// File: AmortBench.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#include "Amort.h"
+#include "AmortGrowth.h"
+#include "AmortSchedule.h"
+#include "AmortCents.h"
+#include "AmortCache.h"
+#include "AmortReader.h"
+#include "AmortQuery.h"
+#include "AmortScenario.h"
+#include "AmortRate.h"
+#include "AmortScan.h"
+#include "AmortSimd.h"
+#include "AmortWriter.h"
+#include "AmortParallel.h"
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define HALF 0.5
+#define HUNDRED 100
+#define EIGHTHS_PER_POINT 8
+#define MAX_EIGHTHS 240
+#define MAX_MONTHS 360
+#define MIN_PRINCIPAL 100.0
+#define PRINCIPAL_SPREAD 50000.0
+#define YEARLY_INTEREST_RATE 1200
+#define BENCH_CASES 4096
+#define BENCH_BATCH 256
+#define HOT_QUOTES 256
+#define MONTHS_PER_YEAR 12
+#define LINE_TEXT 64
+#define LINE_FIELDS 4
+#define EXTRA_SHARE 0.1
+#define LUMP_SHARE 0.05
+#define FIXED_MONTHS 60
+#define RESET_STEP 0.25
+#define SCHEDULE_BATCH 4
+#define STANDARD_TERM_COUNT 6
+#define SCAN_DAYS 36500
+#define DAYS_PER_YEAR 365
+#define DEFAULT_SAMPLES 2000
+#define NANOSECONDS 1e9
+#define PERCENT 100
+//what the name filter is matched against for compareStandardTerms()
+#define STANDARD_NAME "std terms: generateSchedule cursor"
+#define DISPATCH_THREADS 4
+#ifdef _WIN32
+#define NULL_DEVICE "NUL"
+#else
+#define NULL_DEVICE "/dev/null"
+#endif
+
+typedef double (*BenchBody)(int begin, int end);
+//----------------------------------------------------------------------------
+// Benchmark: one timed entry point
+//		batch	calls timed together for one latency sample
+//		simd	SIMD level to run it at, or -1 to leave the level alone
+//----------------------------------------------------------------------------
+typedef struct Benchmark {
+	const char* name;
+	BenchBody body;
+	int batch;
+	int simd;
+} Benchmark;
+
+//the loans every benchmark walks through, one column per field
+static int months[BENCH_CASES];
+static int standardMonths[BENCH_CASES];
+static int aprEighths[BENCH_CASES];
+static double apr[BENCH_CASES];
+static double monthlyRate[BENCH_CASES];
+static double principal[BENCH_CASES];
+static double payment[BENCH_CASES];
+static long long principalCents[BENCH_CASES];
+static long long paymentCents[BENCH_CASES];
+static char loanText[BENCH_CASES][LINE_TEXT];
+static int loanLength[BENCH_CASES];
+static double results[BENCH_BATCH];
+static int monthResults[BENCH_BATCH];
+static ScheduleRow rows[MAX_MONTHS];
+static CentsRow centsRows[MAX_MONTHS];
+static CentsRow scanRows[SCAN_DAYS];
+static ScheduleRow textRows[MAX_MONTHS];
+static int textCount = 0;
+static FILE* nullFile = NULL;
+static RateSegment segments[MAX_MONTHS];
+static ScheduleIndex indexes[BENCH_CASES];
+static TableWriter writer;
+static const int standardTerms[STANDARD_TERM_COUNT] = {
+	36, 48, 60, 72, 180, 360
+};
+static unsigned long long seed = 88172645463325252ULL;
+static volatile double sink = 0.0;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, so every run times the same loans
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		a number in [0, 1)
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (double)(seed >> 11) / 9007199254740992.0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		nowSeconds()
+//  Title:			Now seconds
+//	Description:	This function will read the monotonic clock
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		the time in seconds
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double nowSeconds(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER count;
+	LARGE_INTEGER frequency;
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&frequency);
+	return (double)count.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec / NANOSECONDS;
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeCases()
+//  Title:			Make cases
+//	Description:	This function will draw the loans: APR in eighths from 0
+//					to 30%, terms from 1 to 360 months, principal spread
+//					evenly on a log scale from $100 to $5M, and the payment
+//					the menu would calculate for them. Each loan also gets
+//					one of the standard terms in turn. The first loan's
+//					table over MAX_MONTHS is kept for timing the formatting
+//					alone
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//					roundToNearestCent()
+//					getPaymentAmount()
+//					toCents()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the benchmark suite
+//					10/17/2026 each loan as a batch file line
+//					10/17/2026 a standard term for each loan
+//					10/17/2026 a table kept for the formatting entries
+//----------------------------------------------------------------------------
+static void makeCases(void)
+{
+	int i = 0;
+	for (i = 0; i < BENCH_CASES; i++)
+	{
+		aprEighths[i] = (int)(nextRandom() * (MAX_EIGHTHS + ONE));
+		months[i] = ONE + (int)(nextRandom() * MAX_MONTHS);
+		standardMonths[i] = standardTerms[i % STANDARD_TERM_COUNT];
+		principal[i] = roundToNearestCent(MIN_PRINCIPAL *
+			pow(PRINCIPAL_SPREAD, nextRandom()));
+		monthlyRate[i] = ((double)aprEighths[i] / EIGHTHS_PER_POINT) /
+			YEARLY_INTEREST_RATE;
+		//what a user types before roundToOneEighth() cleans it up
+		apr[i] = (aprEighths[i] + nextRandom() - HALF) / EIGHTHS_PER_POINT;
+		payment[i] = getPaymentAmount(months[i], principal[i], monthlyRate[i]);
+		principalCents[i] = toCents(principal[i]);
+		paymentCents[i] = toCents(payment[i]);
+		loanLength[i] = snprintf(loanText[i], LINE_TEXT, "P,%.3f,%.2f,,%d",
+			apr[i], principal[i], months[i]);
+	}
+	textCount = generateSchedule(principal[ZERO], getPaymentAmount(MAX_MONTHS,
+		principal[ZERO], monthlyRate[ZERO]), monthlyRate[ZERO], MAX_MONTHS,
+		textRows);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchPayment()
+//  Title:			Bench payment
+//	Description:	This function will time getPaymentAmount() for loans
+//					begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			getPaymentAmount()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchPayment(int begin, int end)
+{
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		sum += getPaymentAmount(months[i], principal[i], monthlyRate[i]);
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchLoan()
+//  Title:			Bench loan
+//	Description:	This function will time getLoanAmount() for loans
+//					begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			getLoanAmount()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchLoan(int begin, int end)
+{
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		sum += getLoanAmount(months[i], payment[i], monthlyRate[i]);
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchMonths()
+//  Title:			Bench months
+//	Description:	This function will time getNumberOfMonths() for loans
+//					begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			getNumberOfMonths()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchMonths(int begin, int end)
+{
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		sum += getNumberOfMonths(principal[i], payment[i], monthlyRate[i]);
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchRate()
+//  Title:			Bench rate
+//	Description:	This function will time getInterestRate() for loans
+//					begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			getInterestRate()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchRate(int begin, int end)
+{
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		sum += getInterestRate(principal[i], payment[i], months[i]);
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchEighth()
+//  Title:			Bench eighth
+//	Description:	This function will time roundToOneEighth() on APRs as
+//					typed, for loans begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			roundToOneEighth()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchEighth(int begin, int end)
+{
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		sum += roundToOneEighth(apr[i]);
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchQuote()
+//  Title:			Bench quote
+//	Description:	This function will time amortCalculate() finding the
+//					APR of loans begin to end - 1, folded onto the first
+//					HOT_QUOTES loans the way repeated quotes arrive
+//	Input:			None
+//	Output:			None
+//	Calls:			amortCalculate()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the quote cache
+//----------------------------------------------------------------------------
+static double benchQuote(int begin, int end)
+{
+	AmortRequest request;
+	AmortResult result;
+	double sum = 0.0;
+	int i = 0;
+	request.mode = 'I';
+	request.apr = 0.0;
+	request.arithmetic = ARITHMETIC_DOUBLE;
+	for (i = begin; i < end; i++)
+	{
+		request.principal = principal[i % HOT_QUOTES];
+		request.payment = payment[i % HOT_QUOTES];
+		request.months = months[i % HOT_QUOTES];
+		amortCalculate(&request, &result);
+		sum += result.apr;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchCachedQuote()
+//  Title:			Bench cached quote
+//	Description:	This function will time cachedCalculate() on the
+//					quotes benchQuote() times
+//	Input:			None
+//	Output:			None
+//	Calls:			cachedCalculate()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the quote cache
+//----------------------------------------------------------------------------
+static double benchCachedQuote(int begin, int end)
+{
+	AmortRequest request;
+	AmortResult result;
+	double sum = 0.0;
+	int i = 0;
+	request.mode = 'I';
+	request.apr = 0.0;
+	request.arithmetic = ARITHMETIC_DOUBLE;
+	for (i = begin; i < end; i++)
+	{
+		request.principal = principal[i % HOT_QUOTES];
+		request.payment = payment[i % HOT_QUOTES];
+		request.months = months[i % HOT_QUOTES];
+		cachedCalculate(&request, &result);
+		sum += result.apr;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchPaymentArray()
+//  Title:			Bench payment array
+//	Description:	This function will time getPaymentAmountArray() for loans
+//					begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			getPaymentAmountArray()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchPaymentArray(int begin, int end)
+{
+	getPaymentAmountArray(&months[begin], &principal[begin],
+		&monthlyRate[begin], results, end - begin);
+	return results[ZERO];
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchLoanArray()
+//  Title:			Bench loan array
+//	Description:	This function will time getLoanAmountArray() for loans
+//					begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			getLoanAmountArray()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchLoanArray(int begin, int end)
+{
+	getLoanAmountArray(&months[begin], &payment[begin], &monthlyRate[begin],
+		results, end - begin);
+	return results[ZERO];
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchMonthsArray()
+//  Title:			Bench months array
+//	Description:	This function will time getNumberOfMonthsArray() for loans
+//					begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			getNumberOfMonthsArray()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchMonthsArray(int begin, int end)
+{
+	getNumberOfMonthsArray(&principal[begin], &payment[begin],
+		&monthlyRate[begin], monthResults, end - begin);
+	return monthResults[ZERO];
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchRateArray()
+//  Title:			Bench rate array
+//	Description:	This function will time getInterestRateArray() for loans
+//					begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			getInterestRateArray()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchRateArray(int begin, int end)
+{
+	getInterestRateArray(&principal[begin], &payment[begin], &months[begin],
+		results, end - begin);
+	return results[ZERO];
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchSchedule()
+//  Title:			Bench schedule
+//	Description:	This function will time generateSchedule() for whole
+//					loans, loans begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			generateSchedule()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchSchedule(int begin, int end)
+{
+	double sum = 0.0;
+	int count = 0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		count = generateSchedule(principal[i], payment[i], monthlyRate[i],
+			months[i], rows);
+		sum += rows[count - ONE].payment;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchStandardSchedule()
+//  Title:			Bench standard-term schedule
+//	Description:	This function will time generateSchedule() for whole
+//					loans at standard terms, which it hands to the
+//					fixed-term kernels, for loans begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			generateSchedule()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the fixed-term kernels
+//----------------------------------------------------------------------------
+static double benchStandardSchedule(int begin, int end)
+{
+	double sum = 0.0;
+	int count = 0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		count = generateSchedule(principal[i], payment[i], monthlyRate[i],
+			standardMonths[i], rows);
+		sum += rows[count - ONE].payment;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchStandardCursor()
+//  Title:			Bench standard-term cursor
+//	Description:	This function will time the same tables as
+//					benchStandardSchedule() pulled row by row from a
+//					ScheduleCursor, the generic path the fixed-term kernels
+//					replace, for loans begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			initScheduleCursor()
+//					nextScheduleRow()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the fixed-term kernels
+//----------------------------------------------------------------------------
+static double benchStandardCursor(int begin, int end)
+{
+	ScheduleCursor cursor;
+	double sum = 0.0;
+	int count = 0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		initScheduleCursor(&cursor, principal[i], payment[i], monthlyRate[i],
+			standardMonths[i]);
+		count = 0;
+		while (nextScheduleRow(&cursor, &rows[count]))
+		{
+			count++;
+		}
+		sum += rows[count - ONE].payment;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchScheduleCents()
+//  Title:			Bench cents schedule
+//	Description:	This function will time generateScheduleCents() for
+//					whole loans, loans begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			generateScheduleCents()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchScheduleCents(int begin, int end)
+{
+	double sum = 0.0;
+	int count = 0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		count = generateScheduleCents(principalCents[i], paymentCents[i],
+			aprEighths[i], months[i], centsRows);
+		sum += (double)centsRows[count - ONE].payment;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeLoan()
+//  Title:			Make loan
+//	Description:	This function will give loan i the form
+//					amortCalculate() leaves a P request in
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		i		(int)
+//					loan	(AmortResult*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for schedule queries
+//----------------------------------------------------------------------------
+static void makeLoan(int i, AmortResult* loan)
+{
+	loan->status = AMORT_OK;
+	loan->apr = (double)aprEighths[i] / EIGHTHS_PER_POINT;
+	loan->monthlyRate = monthlyRate[i];
+	loan->principal = principal[i];
+	loan->payment = payment[i];
+	loan->months = months[i];
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeIndexes()
+//  Title:			Make indexes
+//	Description:	This function will build the schedule index of every
+//					bench loan once, for the query entry points to look up
+//	Input:			None
+//	Output:			None
+//	Calls:			makeLoan()
+//					buildScheduleIndex()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the indexed schedule queries
+//----------------------------------------------------------------------------
+static void makeIndexes(void)
+{
+	AmortResult loan;
+	int i = 0;
+	for (i = 0; i < BENCH_CASES; i++)
+	{
+		makeLoan(i, &loan);
+		buildScheduleIndex(&loan, &indexes[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchBuildIndex()
+//  Title:			Bench build index
+//	Description:	This function will time buildScheduleIndex() and
+//					freeScheduleIndex() for loans begin to end - 1, the
+//					one pass over the table every later query saves
+//	Input:			None
+//	Output:			None
+//	Calls:			makeLoan()
+//					buildScheduleIndex()
+//					getPayoffMonth()
+//					freeScheduleIndex()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the indexed schedule queries
+//----------------------------------------------------------------------------
+static double benchBuildIndex(int begin, int end)
+{
+	AmortResult loan;
+	ScheduleIndex index;
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		makeLoan(i, &loan);
+		buildScheduleIndex(&loan, &index);
+		sum += getPayoffMonth(&index);
+		freeScheduleIndex(&index);
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchBalance()
+//  Title:			Bench balance
+//	Description:	This function will time getBalanceAfter() halfway
+//					through loans begin to end - 1 from their indexes
+//	Input:			None
+//	Output:			None
+//	Calls:			getBalanceAfter()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 looked up in a prebuilt index
+//----------------------------------------------------------------------------
+static double benchBalance(int begin, int end)
+{
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		sum += getBalanceAfter(&indexes[i], months[i] / 2);
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchLevelBalance()
+//  Title:			Bench level balance
+//	Description:	This function will time the constant-time estimate
+//					getLevelBalanceAfter() halfway through loans begin to
+//					end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			makeLoan()
+//					getLevelBalanceAfter()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for schedule queries
+//----------------------------------------------------------------------------
+static double benchLevelBalance(int begin, int end)
+{
+	AmortResult loan;
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		makeLoan(i, &loan);
+		sum += getLevelBalanceAfter(&loan, months[i] / 2);
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchYearTotals()
+//  Title:			Bench year totals
+//	Description:	This function will time getScheduleTotals() for the
+//					last whole year of loans begin to end - 1 from their
+//					indexes
+//	Input:			None
+//	Output:			None
+//	Calls:			getScheduleTotals()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 looked up in a prebuilt index
+//----------------------------------------------------------------------------
+static double benchYearTotals(int begin, int end)
+{
+	ScheduleTotals totals;
+	double sum = 0.0;
+	int last = 0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		last = months[i] - months[i] % MONTHS_PER_YEAR;
+		if (last >= MONTHS_PER_YEAR && getScheduleTotals(&indexes[i],
+			last - MONTHS_PER_YEAR + ONE, last, &totals) == EXIT_SUCCESS)
+		{
+			sum += totals.interestPaid;
+		}
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchScenario()
+//  Title:			Bench scenario
+//	Description:	This function will time runScenario() for loans begin
+//					to end - 1 paying a tenth more from the second year and
+//					a twentieth of the loan at month 24
+//	Input:			None
+//	Output:			None
+//	Calls:			makeLoan()
+//					runScenario()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for prepayment scenarios
+//----------------------------------------------------------------------------
+static double benchScenario(int begin, int end)
+{
+	AmortResult loan;
+	PrepayScenario scenario;
+	ScenarioResult result;
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		makeLoan(i, &loan);
+		scenario.extraMonthly = roundToNearestCent(payment[i] * EXTRA_SHARE);
+		scenario.extraStart = MONTHS_PER_YEAR + ONE;
+		scenario.lumpSum = roundToNearestCent(principal[i] * LUMP_SHARE);
+		scenario.lumpMonth = MONTHS_PER_YEAR * 2;
+		runScenario(&loan, &scenario, &result);
+		sum += result.interestSaved;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		scanDays()
+//  Title:			Scan days
+//	Description:	This function will run scanScheduleCents() for loans
+//					begin to end - 1 as 100-year loans paid every day
+//	Input:			None
+//	Output:			None
+//	Calls:			getPaymentAmount()
+//					toCents()
+//					scanScheduleCents()
+//	Parameters:		begin		(int)
+//					end			(int)
+//					threadCount	(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the prefix scan
+//----------------------------------------------------------------------------
+static double scanDays(int begin, int end, int threadCount)
+{
+	double periodRate = 0.0;
+	double sum = 0.0;
+	int count = 0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		periodRate = ((double)aprEighths[i] / EIGHTHS_PER_POINT) /
+			(HUNDRED * DAYS_PER_YEAR);
+		count = scanScheduleCents(principalCents[i],
+			toCents(getPaymentAmount(SCAN_DAYS, principal[i], periodRate)),
+			periodRate, SCAN_DAYS, scanRows, threadCount);
+		sum += (double)scanRows[count - ONE].payment;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchScanSerial()
+//  Title:			Bench scan serial
+//	Description:	This function will time scanDays() on one thread
+//	Input:			None
+//	Output:			None
+//	Calls:			scanDays()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the prefix scan
+//----------------------------------------------------------------------------
+static double benchScanSerial(int begin, int end)
+{
+	return scanDays(begin, end, ONE);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchScanParallel()
+//  Title:			Bench scan parallel
+//	Description:	This function will time scanDays() on every processor
+//	Input:			None
+//	Output:			None
+//	Calls:			scanDays()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the prefix scan
+//----------------------------------------------------------------------------
+static double benchScanParallel(int begin, int end)
+{
+	return scanDays(begin, end, 0);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		countSlice()
+//  Title:			Count slice
+//	Description:	This function will be the parallel body that does next
+//					to nothing, so benchDispatch() times parallelFor() itself
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		context	(void*) one count per worker
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the worker pool bench
+//----------------------------------------------------------------------------
+static void countSlice(void* context, size_t begin, size_t end, int worker)
+{
+	((size_t*)context)[worker] += end - begin;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchDispatch()
+//  Title:			Bench dispatch
+//	Description:	This function will time one parallelFor() over the
+//					bench loans on DISPATCH_THREADS workers with an empty
+//					body: the cost of waking the pool and waiting for it
+//	Input:			None
+//	Output:			None
+//	Calls:			parallelFor()
+//					countSlice()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the worker pool bench
+//----------------------------------------------------------------------------
+static double benchDispatch(int begin, int end)
+{
+	size_t counts[DISPATCH_THREADS] = { 0, 0, 0, 0 };
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		parallelFor(BENCH_CASES, BENCH_BATCH, DISPATCH_THREADS, countSlice,
+			counts);
+	}
+	for (i = 0; i < DISPATCH_THREADS; i++)
+	{
+		sum += (double)counts[i];
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchRatePath()
+//  Title:			Bench rate path
+//	Description:	This function will time evaluateRatePath() for loans
+//					begin to end - 1 as 5/1 adjustable-rate loans whose APR
+//					steps a quarter point up or down every year after the
+//					fifth
+//	Input:			None
+//	Output:			None
+//	Calls:			evaluateRatePath()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for adjustable-rate schedules
+//----------------------------------------------------------------------------
+static double benchRatePath(int begin, int end)
+{
+	RatePath path;
+	RateResult result;
+	double sum = 0.0;
+	int i = 0;
+	path.segments = segments;
+	for (i = begin; i < end; i++)
+	{
+		path.count = 0;
+		segments[path.count].firstMonth = ONE;
+		segments[path.count++].apr = (double)aprEighths[i] /
+			EIGHTHS_PER_POINT;
+		while (FIXED_MONTHS + (path.count - ONE) * MONTHS_PER_YEAR <
+			months[i])
+		{
+			segments[path.count].firstMonth = FIXED_MONTHS + ONE +
+				(path.count - ONE) * MONTHS_PER_YEAR;
+			segments[path.count].apr = segments[path.count - ONE].apr +
+				((i + path.count) % 2 == ZERO ? RESET_STEP : -RESET_STEP);
+			if (segments[path.count].apr < ZERO)
+			{
+				segments[path.count].apr = ZERO;
+			}
+			path.count++;
+		}
+		evaluateRatePath(principal[i], months[i], &path, &result);
+		sum += result.totalInterest;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchParseStrtod()
+//  Title:			Bench parse strtod
+//	Description:	This function will split the lines of loans begin to
+//					end - 1 with one strtod() per field, the baseline
+//					parseLoanLine() is timed against
+//	Input:			None
+//	Output:			None
+//	Calls:			strtod()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 replaces the timing of the strtod() batch
+//					reader parseLoanLine() took over from
+//----------------------------------------------------------------------------
+static double benchParseStrtod(int begin, int end)
+{
+	const char* cursor = NULL;
+	char* next = NULL;
+	double sum = 0.0;
+	int field = 0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		//skip the mode key; every field follows a comma
+		cursor = loanText[i] + 1;
+		for (field = 0; field < LINE_FIELDS; field++)
+		{
+			sum += strtod(cursor + 1, &next);
+			cursor = next;
+		}
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchParseLine()
+//  Title:			Bench parse line
+//	Description:	This function will time parseLoanLine() on the lines
+//					benchParseStrtod() splits
+//	Input:			None
+//	Output:			None
+//	Calls:			parseLoanLine()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the zero-copy reader
+//----------------------------------------------------------------------------
+static double benchParseLine(int begin, int end)
+{
+	LoanLine line;
+	double sum = 0.0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		parseLoanLine(loanText[i], loanText[i] + loanLength[i], &line);
+		sum += (double)line.principalCents;
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchTableText()
+//  Title:			Bench table text
+//	Description:	This function will time generating and formatting whole
+//					tables, for loans begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			generateSchedule()
+//					writeTableRows()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static double benchTableText(int begin, int end)
+{
+	int count = 0;
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		count = generateSchedule(principal[i], payment[i], monthlyRate[i],
+			months[i], rows);
+		writeTableRows(&writer, rows, count);
+	}
+	return (double)writer.used;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchWriteRows()
+//  Title:			Bench write rows
+//	Description:	This function will time writeTableRows() alone on the
+//					same MAX_MONTHS rows once per loan begin to end - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			writeTableRows()
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+static double benchWriteRows(int begin, int end)
+{
+	int i = 0;
+	for (i = begin; i < end; i++)
+	{
+		writeTableRows(&writer, textRows, textCount);
+	}
+	return (double)writer.used;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchFprintfRows()
+//  Title:			Bench fprintf rows
+//	Description:	This function will time the same rows as
+//					benchWriteRows() written the way printTable() wrote
+//					them before the TableWriter, four fprintf() calls a row
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		begin	(int)
+//					end		(int)
+//  Returns:		a value that keeps the calls from being optimized away
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+static double benchFprintfRows(int begin, int end)
+{
+	const ScheduleRow* row = NULL;
+	int i = 0;
+	int k = 0;
+	for (i = begin; i < end; i++)
+	{
+		for (k = 0; k < textCount; k++)
+		{
+			row = &textRows[k];
+			fprintf(nullFile, "%-5d ( %8.2lf) ", row->month, row->payment);
+			fprintf(nullFile, "$ %13.2lf ", row->principalPaid);
+			fprintf(nullFile, "$ %13.2lf ", row->interestPaid);
+			fprintf(nullFile, "$ %12.2lf \n", row->balance);
+		}
+	}
+	return (double)textCount;
+}
+
+static const Benchmark benchmarks[] = {
+	{ "getPaymentAmount", benchPayment, BENCH_BATCH, -1 },
+	{ "getLoanAmount", benchLoan, BENCH_BATCH, -1 },
+	{ "getNumberOfMonths", benchMonths, BENCH_BATCH, -1 },
+	{ "getInterestRate", benchRate, BENCH_BATCH, -1 },
+	{ "roundToOneEighth", benchEighth, BENCH_BATCH, -1 },
+	{ "amortCalculate I (hot)", benchQuote, BENCH_BATCH, -1 },
+	{ "cachedCalculate I (hot)", benchCachedQuote, BENCH_BATCH, -1 },
+	{ "getPaymentAmountArray", benchPaymentArray, BENCH_BATCH, SIMD_NONE },
+	{ "getPaymentAmountArray", benchPaymentArray, BENCH_BATCH, SIMD_AVX2 },
+	{ "getLoanAmountArray", benchLoanArray, BENCH_BATCH, SIMD_NONE },
+	{ "getLoanAmountArray", benchLoanArray, BENCH_BATCH, SIMD_AVX2 },
+	{ "getNumberOfMonthsArray", benchMonthsArray, BENCH_BATCH, SIMD_NONE },
+	{ "getNumberOfMonthsArray", benchMonthsArray, BENCH_BATCH, SIMD_AVX2 },
+	{ "getInterestRateArray", benchRateArray, BENCH_BATCH, SIMD_NONE },
+	{ "getInterestRateArray", benchRateArray, BENCH_BATCH, SIMD_AVX2 },
+	{ "generateSchedule", benchSchedule, SCHEDULE_BATCH, -1 },
+	{ "generateScheduleCents", benchScheduleCents, SCHEDULE_BATCH, -1 },
+	{ "schedule+writeTableRows", benchTableText, SCHEDULE_BATCH, -1 },
+	{ "writeTableRows (360 rows)", benchWriteRows, SCHEDULE_BATCH, -1 },
+	{ "fprintf (360 rows)", benchFprintfRows, SCHEDULE_BATCH, -1 },
+	{ "scanScheduleCents (1 thread)", benchScanSerial, ONE, -1 },
+	{ "scanScheduleCents (threads)", benchScanParallel, ONE, -1 },
+	{ "parallelFor (4 threads, empty)", benchDispatch, ONE, -1 },
+	{ "buildScheduleIndex", benchBuildIndex, SCHEDULE_BATCH, -1 },
+	{ "getBalanceAfter", benchBalance, BENCH_BATCH, -1 },
+	{ "getLevelBalanceAfter", benchLevelBalance, BENCH_BATCH, -1 },
+	{ "getScheduleTotals (year)", benchYearTotals, BENCH_BATCH, -1 },
+	{ "runScenario", benchScenario, BENCH_BATCH, -1 },
+	{ "evaluateRatePath (5/1)", benchRatePath, BENCH_BATCH, -1 },
+	{ "strtod fields", benchParseStrtod, BENCH_BATCH, -1 },
+	{ "parseLoanLine", benchParseLine, BENCH_BATCH, -1 }
+};
+
+//----------------------------------------------------------------------------
+//	Function:		compareDoubles()
+//  Title:			Compare doubles
+//	Description:	This function will order two samples for qsort()
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		left	(const void*)
+//					right	(const void*)
+//  Returns:		-1, 0 or 1
+//	History Log:	10/17/2026 written for the benchmark suite
+//----------------------------------------------------------------------------
+static int compareDoubles(const void* left, const void* right)
+{
+	double a = *(const double*)left;
+	double b = *(const double*)right;
+	return a < b ? -ONE : (a > b ? ONE : ZERO);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		printResult()
+//  Title:			Print result
+//	Description:	This function will sort the per-call times of one entry
+//					point and print its line: the mean ns per call, calls
+//					per second and the 50th, 90th and 99th percentile
+//	Input:			None
+//	Output:			one line of results to the console
+//	Calls:			compareDoubles()
+//	Parameters:		name	(const char*)
+//					times	(double*) sorted in place
+//					samples	(int)
+//					total	(double) the times added up
+//  Returns:		void
+//	History Log:	10/17/2026 moved out of runBenchmark()
+//----------------------------------------------------------------------------
+static void printResult(const char* name, double* times, int samples,
+	double total)
+{
+	qsort(times, samples, sizeof(double), compareDoubles);
+	printf("%-30s %10.1f %12.3f %10.1f %10.1f %10.1f\n", name,
+		total / samples, samples * NANOSECONDS / total / 1e6,
+		times[samples * 50 / PERCENT], times[samples * 90 / PERCENT],
+		times[samples * 99 / PERCENT]);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runBenchmark()
+//  Title:			Run benchmark
+//	Description:	This function will time one entry point: a warm-up pass
+//					over every loan, then samples of batch calls each, and
+//					print the mean ns per call, calls per second and the
+//					50th, 90th and 99th percentile of the per-call time of
+//					the samples
+//	Input:			None
+//	Output:			one line of results to the console
+//	Calls:			nowSeconds()
+//					printResult()
+//	Parameters:		benchmark	(const Benchmark*)
+//					samples		(int)
+//					times		(double*) room for samples values
+//  Returns:		void
+//	History Log:	10/17/2026 written for the benchmark suite
+//					10/17/2026 the line printed by printResult()
+//----------------------------------------------------------------------------
+static void runBenchmark(const Benchmark* benchmark, int samples,
+	double* times)
+{
+	char name[64];
+	double total = 0.0;
+	double start = 0.0;
+	int begin = 0;
+	int i = 0;
+
+	for (begin = 0; begin < BENCH_CASES; begin += benchmark->batch)
+	{
+		sink += benchmark->body(begin, begin + benchmark->batch);
+	}
+	begin = 0;
+	for (i = 0; i < samples; i++)
+	{
+		start = nowSeconds();
+		sink += benchmark->body(begin, begin + benchmark->batch);
+		times[i] = (nowSeconds() - start) * NANOSECONDS / benchmark->batch;
+		total += times[i];
+		begin = (begin + benchmark->batch) % BENCH_CASES;
+	}
+	if (benchmark->simd >= ZERO)
+	{
+		sprintf(name, "%s/%s", benchmark->name,
+			benchmark->simd == SIMD_AVX2 ? "avx2" : "scalar");
+	}
+	else
+	{
+		sprintf(name, "%s", benchmark->name);
+	}
+	printResult(name, times, samples, total);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		compareStandardTerms()
+//  Title:			Compare standard terms
+//	Description:	This function will time generateSchedule() on the
+//					standard-term loans, which it hands to the fixed-term
+//					kernels, against the same tables pulled from a
+//					ScheduleCursor, the generic path it takes for any other
+//					term. Every sample times one batch both ways on the
+//					same loans, the order swapped from sample to sample, so
+//					the two lines and the speedup under them are measured
+//					in the same conditions
+//	Input:			None
+//	Output:			a line for each path and the kernels' speedup
+//	Calls:			benchStandardSchedule()
+//					benchStandardCursor()
+//					nowSeconds()
+//					printResult()
+//	Parameters:		samples	(int)
+//					times	(double*) room for 2 * samples values
+//  Returns:		void
+//	History Log:	10/17/2026 written so the kernels are measured against
+//					the generic path directly
+//----------------------------------------------------------------------------
+static void compareStandardTerms(int samples, double* times)
+{
+	double* cursorTimes = times + samples;
+	double kernelTotal = 0.0;
+	double cursorTotal = 0.0;
+	double start = 0.0;
+	int begin = 0;
+	int i = 0;
+
+	for (begin = 0; begin < BENCH_CASES; begin += SCHEDULE_BATCH)
+	{
+		sink += benchStandardSchedule(begin, begin + SCHEDULE_BATCH);
+		sink += benchStandardCursor(begin, begin + SCHEDULE_BATCH);
+	}
+	begin = 0;
+	for (i = 0; i < samples; i++)
+	{
+		if (i % 2 == ONE)
+		{
+			start = nowSeconds();
+			sink += benchStandardCursor(begin, begin + SCHEDULE_BATCH);
+			cursorTimes[i] = (nowSeconds() - start) * NANOSECONDS /
+				SCHEDULE_BATCH;
+		}
+		start = nowSeconds();
+		sink += benchStandardSchedule(begin, begin + SCHEDULE_BATCH);
+		times[i] = (nowSeconds() - start) * NANOSECONDS / SCHEDULE_BATCH;
+		if (i % 2 == ZERO)
+		{
+			start = nowSeconds();
+			sink += benchStandardCursor(begin, begin + SCHEDULE_BATCH);
+			cursorTimes[i] = (nowSeconds() - start) * NANOSECONDS /
+				SCHEDULE_BATCH;
+		}
+		kernelTotal += times[i];
+		cursorTotal += cursorTimes[i];
+		begin = (begin + SCHEDULE_BATCH) % BENCH_CASES;
+	}
+	printResult("std terms: generateSchedule", times, samples, kernelTotal);
+	printResult("std terms: cursor", cursorTimes, samples, cursorTotal);
+	printf("%-30s %9.2fx %12s %9.2fx\n", "std terms: kernel speedup",
+		cursorTotal / kernelTotal, "",
+		cursorTimes[samples * 50 / PERCENT] / times[samples * 50 / PERCENT]);
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Amortization Benchmark
+//
+// Description:		Times every calculation in Amort.h, the array kernels
+//					with and without SIMD, and schedule generation over the
+//					same loans on every run. "AmortBench [samples] [name]"
+//					takes more or fewer samples per entry point and runs only
+//					the entry points whose name contains name
+//
+// Output:			One line per entry point: ns per call, millions of calls
+//					per second and percentile ns per call
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when memory runs out
+// Called By:		None
+// Calls:			initGrowthTable()
+//					initQuoteCache()
+//					makeCases()
+//					makeIndexes()
+//					getThreadCount()
+//					runBenchmark()
+//					compareStandardTerms()
+//
+// History Log:		10/17/2026: written for the benchmark suite
+//					10/17/2026: quote cache entry points
+//					10/17/2026: schedule query entry points
+//					10/17/2026: prepayment scenario entry point
+//					10/17/2026: adjustable-rate entry point
+//					10/17/2026: batch line parser entry points
+//					10/17/2026: standard-term schedule entry points
+//					10/17/2026: prefix-scan schedule entry points
+//					10/17/2026: table formatting against fprintf()
+//					10/17/2026: processor count in the heading
+//					10/17/2026: schedule index build timed apart from the
+//					lookups
+//					10/17/2026: standard-term kernels timed against the
+//					cursor in the same samples
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int samples = argc >= 2 ? atoi(argv[1]) : DEFAULT_SAMPLES;
+	const char* only = argc >= 3 ? argv[2] : NULL;
+	int supported = getSimdLevel();
+	double* times = NULL;
+	size_t i = 0;
+
+	if (samples <= ZERO)
+	{
+		samples = DEFAULT_SAMPLES;
+	}
+	//compareStandardTerms() keeps two sets of samples
+	times = malloc(2 * (size_t)samples * sizeof(double));
+	nullFile = fopen(NULL_DEVICE, "w");
+	if (times == NULL || nullFile == NULL ||
+		openTableWriter(&writer, nullFile) != EXIT_SUCCESS)
+	{
+		printf("Could not set up the benchmark.\n");
+		return EXIT_FAILURE;
+	}
+	initGrowthTable();
+	initQuoteCache();
+	makeCases();
+	//"(threads)" entries can only beat "(1 thread)" with more processors
+	printf("%d loans, %d samples per entry point, processors: %d\n\n",
+		BENCH_CASES, samples, getThreadCount(0));
+	printf("%-30s %10s %12s %10s %10s %10s\n", "entry point", "ns/op",
+		"Mops/s", "p50 ns", "p90 ns", "p99 ns");
+	for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++)
+	{
+		if ((only != NULL && strstr(benchmarks[i].name, only) == NULL) ||
+			benchmarks[i].simd > supported)
+		{
+			continue;
+		}
+		if (benchmarks[i].simd >= ZERO)
+		{
+			setSimdLevel(benchmarks[i].simd);
+		}
+		runBenchmark(&benchmarks[i], samples, times);
+		setSimdLevel(supported);
+	}
+	if (only == NULL || strstr(STANDARD_NAME, only) != NULL)
+	{
+		compareStandardTerms(samples, times);
+	}
+	closeTableWriter(&writer);
+	fclose(nullFile);
+	free(times);
+	return EXIT_SUCCESS;
+}
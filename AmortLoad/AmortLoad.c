@@ -0,0 +1,483 @@
+//----------------------------------------------------------------------------
+// File: AmortLoad.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "Amort.h"
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define EIGHTHS_PER_POINT 8
+#define MAX_EIGHTHS 240
+#define MAX_MONTHS 360
+#define MIN_PRINCIPAL 100.0
+#define PRINCIPAL_SPREAD 50000.0
+#define YEARLY_INTEREST_RATE 1200
+#define LOAD_CASES 4096
+#define LINE_MAX_LENGTH 256
+#define IN_SIZE 65536
+#define OUT_SIZE 65536
+#define MAX_CONNECTIONS 1024
+#define MAX_DEPTH 1024
+#define DEFAULT_CONNECTIONS 4
+#define DEFAULT_DEPTH 16
+#define DEFAULT_REQUESTS 200000
+#define LOAD_EVENTS 64
+#define NANOSECONDS 1000000000LL
+#define MICROSECONDS 1000.0
+#define PERCENT 100
+#define PERMILLE 1000
+#define UNIX_PREFIX "unix:"
+#define UNIX_PREFIX_LENGTH 5
+
+//----------------------------------------------------------------------------
+// Client: one connection to the server and the requests it has in flight
+//		sentAt		send times of the requests in flight, oldest at head
+//		rowsLeft	table rows still to come for the answer being read
+//----------------------------------------------------------------------------
+typedef struct Client {
+	int socket;
+	long sent;
+	long answered;
+	long quota;
+	int rowsLeft;
+	size_t inUsed;
+	long long sentAt[MAX_DEPTH];
+	char in[IN_SIZE];
+} Client;
+
+static char requests[LOAD_CASES][LINE_MAX_LENGTH];
+static int requestLengths[LOAD_CASES];
+static unsigned long long seed = 88172645463325252ULL;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, so every run sends the same requests
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		a number in [0, 1)
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static double nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (double)(seed >> 11) / 9007199254740992.0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		nowNanoseconds()
+//  Title:			Now nanoseconds
+//	Description:	This function will read the monotonic clock
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		the time in nanoseconds
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static long long nowNanoseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long)now.tv_sec * NANOSECONDS + now.tv_nsec;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeRequests()
+//  Title:			Make requests
+//	Description:	This function will write the request lines: the four
+//					menu calculations in turn over APRs from 0 to 30%,
+//					terms from 1 to 360 months and principals from $100 to
+//					$5M, with schedulePercent of them asking for the whole
+//					table instead
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//					roundToNearestCent()
+//					getPaymentAmount()
+//	Parameters:		schedulePercent	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static void makeRequests(int schedulePercent)
+{
+	const char modes[] = "PLNI";
+	double apr = 0.0;
+	double principal = 0.0;
+	double payment = 0.0;
+	int months = 0;
+	char mode = ' ';
+	int i = 0;
+	for (i = 0; i < LOAD_CASES; i++)
+	{
+		apr = (double)(int)(nextRandom() * (MAX_EIGHTHS + ONE)) /
+			EIGHTHS_PER_POINT;
+		months = ONE + (int)(nextRandom() * MAX_MONTHS);
+		principal = roundToNearestCent(MIN_PRINCIPAL *
+			pow(PRINCIPAL_SPREAD, nextRandom()));
+		payment = getPaymentAmount(months, principal,
+			apr / YEARLY_INTEREST_RATE);
+		mode = nextRandom() * PERCENT < schedulePercent ? 'S' : modes[i % 4];
+		requestLengths[i] = sprintf(requests[i], "%c,%.3lf,%.2lf,%.2lf,%d\n",
+			mode, apr, principal, payment, months);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		connectServer()
+//  Title:			Connect server
+//	Description:	This function will connect to "unix:path" or "host:port"
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		address	(const char*)
+//  Returns:		the connected socket, or -1
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static int connectServer(const char* address)
+{
+	struct sockaddr_un local;
+	struct addrinfo hints;
+	struct addrinfo* found = NULL;
+	char host[LINE_MAX_LENGTH];
+	const char* colon = strrchr(address, ':');
+	int client = -ONE;
+	int on = ONE;
+
+	if (strncmp(address, UNIX_PREFIX, UNIX_PREFIX_LENGTH) == ZERO)
+	{
+		memset(&local, ZERO, sizeof(local));
+		local.sun_family = AF_UNIX;
+		strncpy(local.sun_path, address + UNIX_PREFIX_LENGTH,
+			sizeof(local.sun_path) - ONE);
+		client = socket(AF_UNIX, SOCK_STREAM, ZERO);
+		if (client >= ZERO && connect(client, (struct sockaddr*)&local,
+			sizeof(local)) != ZERO)
+		{
+			close(client);
+			client = -ONE;
+		}
+	}
+	else if (colon != NULL && (size_t)(colon - address) < sizeof(host))
+	{
+		memcpy(host, address, colon - address);
+		host[colon - address] = '\0';
+		memset(&hints, ZERO, sizeof(hints));
+		hints.ai_family = AF_UNSPEC;
+		hints.ai_socktype = SOCK_STREAM;
+		if (getaddrinfo(host[ZERO] != '\0' ? host : "localhost", colon + ONE,
+			&hints, &found) != ZERO)
+		{
+			return -ONE;
+		}
+		client = socket(found->ai_family, found->ai_socktype,
+			found->ai_protocol);
+		if (client >= ZERO && connect(client, found->ai_addr,
+			found->ai_addrlen) != ZERO)
+		{
+			close(client);
+			client = -ONE;
+		}
+		freeaddrinfo(found);
+		if (client >= ZERO)
+		{
+			setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+		}
+	}
+	return client;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		sendRequests()
+//  Title:			Send requests
+//	Description:	This function will send requests until depth of them
+//					are in flight on the client or its quota is used up
+//	Input:			None
+//	Output:			requests to the server
+//	Calls:			nowNanoseconds()
+//	Parameters:		client	(Client*)
+//					depth	(int)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the send fails
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static int sendRequests(Client* client, int depth)
+{
+	char out[OUT_SIZE];
+	size_t used = 0;
+	size_t done = 0;
+	ssize_t sent = 0;
+	long first = client->sent;
+	long long now = 0;
+	int line = 0;
+
+	while (client->sent - client->answered < depth &&
+		client->sent < client->quota && used + LINE_MAX_LENGTH <= OUT_SIZE)
+	{
+		line = (int)((client->sent * 7919 + client->socket) % LOAD_CASES);
+		memcpy(out + used, requests[line], requestLengths[line]);
+		used += requestLengths[line];
+		client->sent++;
+	}
+	now = nowNanoseconds();
+	for (; first < client->sent; first++)
+	{
+		client->sentAt[first % depth] = now;
+	}
+	while (done < used)
+	{
+		sent = send(client->socket, out + done, used - done, MSG_NOSIGNAL);
+		if (sent < ZERO)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return EXIT_FAILURE;
+		}
+		done += (size_t)sent;
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readAnswers()
+//  Title:			Read answers
+//	Description:	This function will read the answers that arrived, skip
+//					the table rows of S answers, and record the time each
+//					request took from being sent to its answer arriving
+//	Input:			answers from the server
+//	Output:			None
+//	Calls:			nowNanoseconds()
+//	Parameters:		client		(Client*)
+//					depth		(int)
+//					latencies	(long long*) one per request
+//					recorded	(long*) latencies recorded so far
+//					errors		(long*) ERROR answers so far
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the server is gone
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static int readAnswers(Client* client, int depth, long long* latencies,
+	long* recorded, long* errors)
+{
+	ssize_t received = recv(client->socket, client->in + client->inUsed,
+		IN_SIZE - client->inUsed, ZERO);
+	long long now = nowNanoseconds();
+	char* line = client->in;
+	char* end = NULL;
+	char* newline = NULL;
+	const char* comma = NULL;
+	int field = 0;
+
+	if (received <= ZERO)
+	{
+		return received < ZERO && errno == EINTR ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	client->inUsed += (size_t)received;
+	end = client->in + client->inUsed;
+	while ((newline = memchr(line, '\n', end - line)) != NULL)
+	{
+		*newline = '\0';
+		if (client->rowsLeft > ZERO)
+		{
+			client->rowsLeft--;
+		}
+		else
+		{
+			if (strstr(line, "ERROR") != NULL)
+			{
+				(*errors)++;
+			}
+			else if (line[ZERO] == 'S')
+			{
+				//the months field tells how many rows follow
+				comma = line;
+				for (field = 0; field < 4 && comma != NULL; field++)
+				{
+					comma = strchr(comma + ONE, ',');
+				}
+				client->rowsLeft = comma != NULL ? atoi(comma + ONE) : ZERO;
+			}
+		}
+		if (client->rowsLeft == ZERO)
+		{
+			latencies[(*recorded)++] = now -
+				client->sentAt[client->answered % depth];
+			client->answered++;
+		}
+		line = newline + ONE;
+	}
+	memmove(client->in, line, end - line);
+	client->inUsed = end - line;
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		compareLatencies()
+//  Title:			Compare latencies
+//	Description:	This function will order two latencies for qsort()
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		left	(const void*)
+//					right	(const void*)
+//  Returns:		-1, 0 or 1
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static int compareLatencies(const void* left, const void* right)
+{
+	long long a = *(const long long*)left;
+	long long b = *(const long long*)right;
+	return a < b ? -ONE : (a > b ? ONE : ZERO);
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Amortization Load Generator
+//
+// Description:		Drives a server started with "--serve": "AmortLoad
+//					address [connections] [depth] [requests] [schedule%]"
+//					opens the connections, keeps depth pipelined requests in
+//					flight on each until requests have been answered, and
+//					reports the answers per second and the latency
+//					percentiles from send to answer
+//
+// Output:			Throughput and latency percentiles
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the server cannot be
+//					reached, drops a connection or answers ERROR
+// Called By:		None
+// Calls:			makeRequests()
+//					connectServer()
+//					sendRequests()
+//					readAnswers()
+//
+// History Log:		10/17/2026: written for the pricing server
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	struct epoll_event events[LOAD_EVENTS];
+	struct epoll_event event;
+	Client* clients = NULL;
+	Client* client = NULL;
+	long long* latencies = NULL;
+	long long start = 0;
+	double seconds = 0.0;
+	int connections = argc >= 3 ? atoi(argv[2]) : DEFAULT_CONNECTIONS;
+	int depth = argc >= 4 ? atoi(argv[3]) : DEFAULT_DEPTH;
+	long total = argc >= 5 ? atol(argv[4]) : DEFAULT_REQUESTS;
+	int schedulePercent = argc >= 6 ? atoi(argv[5]) : ZERO;
+	long recorded = 0;
+	long errors = 0;
+	int open = 0;
+	int poller = -ONE;
+	int ready = 0;
+	int i = 0;
+
+	if (argc < 2 || connections <= ZERO || connections > MAX_CONNECTIONS ||
+		depth <= ZERO || depth > MAX_DEPTH || total <= ZERO)
+	{
+		printf("usage: AmortLoad address [connections] [depth] [requests] "
+			"[schedule%%]\n");
+		return EXIT_FAILURE;
+	}
+	makeRequests(schedulePercent);
+	clients = calloc(connections, sizeof(Client));
+	latencies = malloc(total * sizeof(long long));
+	poller = epoll_create1(ZERO);
+	if (clients == NULL || latencies == NULL || poller < ZERO)
+	{
+		printf("Could not set up the load generator.\n");
+		return EXIT_FAILURE;
+	}
+	for (i = 0; i < connections; i++)
+	{
+		clients[i].socket = connectServer(argv[1]);
+		clients[i].quota = total / connections +
+			(i < total % connections ? ONE : ZERO);
+		event.events = EPOLLIN;
+		event.data.ptr = &clients[i];
+		if (clients[i].socket < ZERO ||
+			epoll_ctl(poller, EPOLL_CTL_ADD, clients[i].socket, &event) != ZERO)
+		{
+			printf("Could not connect to %s.\n", argv[1]);
+			return EXIT_FAILURE;
+		}
+	}
+	start = nowNanoseconds();
+	for (i = 0; i < connections; i++)
+	{
+		if (clients[i].quota > ZERO)
+		{
+			open++;
+			sendRequests(&clients[i], depth);
+		}
+	}
+	while (open > ZERO)
+	{
+		ready = epoll_wait(poller, events, LOAD_EVENTS, -ONE);
+		for (i = 0; i < ready; i++)
+		{
+			client = events[i].data.ptr;
+			if (readAnswers(client, depth, latencies, &recorded,
+				&errors) != EXIT_SUCCESS ||
+				sendRequests(client, depth) != EXIT_SUCCESS)
+			{
+				printf("The server closed a connection.\n");
+				return EXIT_FAILURE;
+			}
+			if (client->answered == client->quota)
+			{
+				epoll_ctl(poller, EPOLL_CTL_DEL, client->socket, NULL);
+				client->quota = -ONE;
+				open--;
+			}
+		}
+	}
+	seconds = (double)(nowNanoseconds() - start) / NANOSECONDS;
+	qsort(latencies, recorded, sizeof(long long), compareLatencies);
+	printf("%ld requests, %d connections, depth %d, %d%% schedules\n",
+		recorded, connections, depth, schedulePercent);
+	printf("%.0lf requests/s\n", recorded / seconds);
+	printf("latency us: p50 %.1lf  p90 %.1lf  p99 %.1lf  p99.9 %.1lf  "
+		"max %.1lf\n",
+		latencies[recorded * 50 / PERCENT] / MICROSECONDS,
+		latencies[recorded * 90 / PERCENT] / MICROSECONDS,
+		latencies[recorded * 99 / PERCENT] / MICROSECONDS,
+		latencies[recorded * 999 / PERMILLE] / MICROSECONDS,
+		latencies[recorded - ONE] / MICROSECONDS);
+	if (errors > ZERO)
+	{
+		printf("%ld ERROR answers\n", errors);
+	}
+	for (i = 0; i < connections; i++)
+	{
+		close(clients[i].socket);
+	}
+	close(poller);
+	free(latencies);
+	free(clients);
+	return errors > ZERO ? EXIT_FAILURE : EXIT_SUCCESS;
+}
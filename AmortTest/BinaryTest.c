@@ -0,0 +1,438 @@
+//----------------------------------------------------------------------------
+// File: BinaryTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Amort.h"
+#include "AmortApi.h"
+#include "AmortGrowth.h"
+#include "AmortCents.h"
+#include "AmortBinary.h"
+#define ONE 1
+#define ZERO 0
+#define THOUSAND 1000
+#define EIGHTHS_PER_POINT 8
+#define THOUSANDTHS_PER_EIGHTH 125
+#define MAX_EIGHTHS 240
+#define MAX_MONTHS 360
+#define MIN_PRINCIPAL 100.0
+#define PRINCIPAL_SPREAD 50000.0
+#define TEST_LOANS 2000
+#define MAX_REPORTS 5
+#define BLOCK_FILE "BinaryTest.bin"
+#define BATCH_FILE "BinaryTest.csv"
+#define BATCH_SCHEDULE_FILE "BinaryTestBatch.bin"
+#define BROKEN_EVERY 97
+
+//the loans every block is written for
+static AmortResult loans[TEST_LOANS];
+static ScheduleRow rows[MAX_MONTHS];
+static CentsRow centsRows[MAX_MONTHS];
+static unsigned long long seed = 88172645463325252ULL;
+static int reports = 0;
+//lines that break a rule, each with the status its block must carry
+static const char* brokenLines[] = { "P,1,-5,,12", "P,seven,1000,,12",
+	"N,12,1000,5," };
+static const int brokenStatus[] = { AMORT_BAD_PRINCIPAL, AMORT_BAD_FORMAT,
+	AMORT_PAYMENT_TOO_SMALL };
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, so every run checks the same loans
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		a number in [0, 1)
+//	History Log:	10/17/2026 written for the binary schedule test
+//----------------------------------------------------------------------------
+static double nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (double)(seed >> 11) / 9007199254740992.0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeLoans()
+//  Title:			Make loans
+//	Description:	This function will calculate the payment of random
+//					loans: APR in eighths from 0 to 30%, terms from 1 to
+//					360 months and principal spread evenly on a log scale
+//					from $100 to $5M
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//					roundToNearestCent()
+//					amortCalculate()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the binary schedule test
+//----------------------------------------------------------------------------
+static void makeLoans(void)
+{
+	AmortRequest request;
+	int i = 0;
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		request.mode = 'P';
+		request.apr = (double)(int)(nextRandom() * (MAX_EIGHTHS + ONE)) /
+			EIGHTHS_PER_POINT;
+		request.months = ONE + (int)(nextRandom() * MAX_MONTHS);
+		request.principal = roundToNearestCent(MIN_PRINCIPAL *
+			pow(PRINCIPAL_SPREAD, nextRandom()));
+		request.payment = 0.0;
+		request.arithmetic = ARITHMETIC_DOUBLE;
+		amortCalculate(&request, &loans[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkColumn()
+//  Title:			Check column
+//	Description:	This function will count the rows where a column read
+//					back from the file is not what was written, printing
+//					the first few
+//	Input:			None
+//	Output:			the rows that differ
+//	Calls:			None
+//	Parameters:		name		(const char*)
+//					loan		(int)
+//					column		(const long long*) read from the file
+//					expected	(const long long*)
+//					count		(int)
+//  Returns:		the number of rows that differ
+//	History Log:	10/17/2026 written for the binary schedule test
+//----------------------------------------------------------------------------
+static int checkColumn(const char* name, int loan, const long long* column,
+	const long long* expected, int count)
+{
+	int failures = 0;
+	int i = 0;
+	for (i = 0; i < count; i++)
+	{
+		if (column[i] != expected[i] && failures++ == ZERO &&
+			reports++ < MAX_REPORTS)
+		{
+			printf("  loan %d %s row %d: %lld instead of %lld\n", loan, name,
+				i + ONE, column[i], expected[i]);
+		}
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkBlock()
+//  Title:			Check block
+//	Description:	This function will compare one block read back in place
+//					with the header and rows it was written from
+//	Input:			None
+//	Output:			the fields that differ
+//	Calls:			checkColumn()
+//	Parameters:		view			(const ScheduleView*)
+//					loan			(int)
+//					principalCents	(long long)
+//					aprThousandths	(int)
+//					months			(int)
+//					expected		(long long*) the four columns one after
+//									the other, count rows each
+//					count			(int)
+//  Returns:		the number of fields that differ
+//	History Log:	10/17/2026 written for the binary schedule test
+//					10/17/2026 the status must be AMORT_OK
+//----------------------------------------------------------------------------
+static int checkBlock(const ScheduleView* view, int loan,
+	long long principalCents, int aprThousandths, int months,
+	long long* expected, int count)
+{
+	int failures = 0;
+	if (view->header->principalCents != principalCents ||
+		view->header->aprThousandths != aprThousandths ||
+		view->header->months != months || view->header->rowCount != count ||
+		view->header->status != AMORT_OK)
+	{
+		if (reports++ < MAX_REPORTS)
+		{
+			printf("  loan %d header differs\n", loan);
+		}
+		return ONE;
+	}
+	failures += checkColumn("payment", loan, view->payment, expected, count);
+	failures += checkColumn("principal paid", loan, view->principalPaid,
+		expected + count, count);
+	failures += checkColumn("interest paid", loan, view->interestPaid,
+		expected + count * 2, count);
+	failures += checkColumn("balance", loan, view->balance,
+		expected + count * 3, count);
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getColumns()
+//  Title:			Get columns
+//	Description:	This function will lay out a double table's rows as the
+//					four cents columns a block should hold
+//	Input:			None
+//	Output:			None
+//	Calls:			toCents()
+//	Parameters:		table		(const ScheduleRow*)
+//					count		(int)
+//					columns		(long long*) room for 4 * count
+//  Returns:		void
+//	History Log:	10/17/2026 written for the binary schedule test
+//----------------------------------------------------------------------------
+static void getColumns(const ScheduleRow* table, int count,
+	long long* columns)
+{
+	int i = 0;
+	for (i = 0; i < count; i++)
+	{
+		columns[i] = toCents(table[i].payment);
+		columns[count + i] = toCents(table[i].principalPaid);
+		columns[count * 2 + i] = toCents(table[i].interestPaid);
+		columns[count * 3 + i] = toCents(table[i].balance);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getCentsColumns()
+//  Title:			Get cents columns
+//	Description:	This function will lay out a cents table's rows as the
+//					four columns a block should hold
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		table		(const CentsRow*)
+//					count		(int)
+//					columns		(long long*) room for 4 * count
+//  Returns:		void
+//	History Log:	10/17/2026 written for the binary schedule test
+//----------------------------------------------------------------------------
+static void getCentsColumns(const CentsRow* table, int count,
+	long long* columns)
+{
+	int i = 0;
+	for (i = 0; i < count; i++)
+	{
+		columns[i] = table[i].payment;
+		columns[count + i] = table[i].principalPaid;
+		columns[count * 2 + i] = table[i].interestPaid;
+		columns[count * 3 + i] = table[i].balance;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkRoundTrip()
+//  Title:			Check round trip
+//	Description:	This function will write a double block and a cents
+//					block for every loan, map the file, read every block
+//					back in place and compare it with the rows it came from
+//	Input:			None
+//	Output:			BLOCK_FILE, the blocks that differ
+//	Calls:			generateSchedule()
+//					generateScheduleCents()
+//					writeScheduleBlock()
+//					writeCentsBlock()
+//					openScheduleFile()
+//					readNextSchedule()
+//					closeScheduleFile()
+//					getColumns()
+//					getCentsColumns()
+//					checkBlock()
+//	Parameters:		None
+//  Returns:		the number of fields that differ
+//	History Log:	10/17/2026 written for the binary schedule test
+//----------------------------------------------------------------------------
+static int checkRoundTrip(void)
+{
+	static long long expected[BINARY_COLUMNS * MAX_MONTHS];
+	ScheduleFile schedules;
+	ScheduleView view;
+	FILE* file = fopen(BLOCK_FILE, "wb");
+	const AmortResult* loan = NULL;
+	int aprEighths = 0;
+	int count = 0;
+	int failures = 0;
+	int i = 0;
+
+	if (file == NULL)
+	{
+		printf("  could not create %s\n", BLOCK_FILE);
+		return ONE;
+	}
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		loan = &loans[i];
+		aprEighths = (int)(loan->apr * EIGHTHS_PER_POINT);
+		count = generateSchedule(loan->principal, loan->payment,
+			loan->monthlyRate, loan->months, rows);
+		failures += writeScheduleBlock(file, loan->principal,
+			loan->monthlyRate, loan->months, rows, count) != EXIT_SUCCESS;
+		count = generateScheduleCents(toCents(loan->principal),
+			toCents(loan->payment), aprEighths, loan->months, centsRows);
+		failures += writeCentsBlock(file, toCents(loan->principal),
+			aprEighths, loan->months, centsRows, count) != EXIT_SUCCESS;
+	}
+	if (fclose(file) != ZERO || failures > ZERO ||
+		openScheduleFile(&schedules, BLOCK_FILE) != EXIT_SUCCESS)
+	{
+		printf("  could not write or map %s\n", BLOCK_FILE);
+		return ONE;
+	}
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		loan = &loans[i];
+		aprEighths = (int)(loan->apr * EIGHTHS_PER_POINT);
+		count = generateSchedule(loan->principal, loan->payment,
+			loan->monthlyRate, loan->months, rows);
+		getColumns(rows, count, expected);
+		failures += readNextSchedule(&schedules, &view) != SCHEDULE_FOUND ||
+			checkBlock(&view, i, toCents(loan->principal),
+			(int)floor(loan->apr * THOUSAND + 0.5), loan->months, expected,
+			count) != ZERO;
+		count = generateScheduleCents(toCents(loan->principal),
+			toCents(loan->payment), aprEighths, loan->months, centsRows);
+		getCentsColumns(centsRows, count, expected);
+		failures += readNextSchedule(&schedules, &view) != SCHEDULE_FOUND ||
+			checkBlock(&view, i, toCents(loan->principal),
+			aprEighths * THOUSANDTHS_PER_EIGHTH, loan->months, expected,
+			count) != ZERO;
+	}
+	failures += readNextSchedule(&schedules, &view) != SCHEDULE_END;
+	closeScheduleFile(&schedules);
+	remove(BLOCK_FILE);
+	printf("  round trip of %d blocks: %d differ\n", TEST_LOANS * 2,
+		failures);
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkScheduleFile()
+//  Title:			Check schedule file
+//	Description:	This function will write the loans as a batch file with
+//					a broken line every BROKEN_EVERY loans, turn it into a
+//					schedule file with runScheduleFile() and check that
+//					every good line came back as its table and every broken
+//					one as a block of no rows carrying its status, in the
+//					order of the lines
+//	Input:			None
+//	Output:			BATCH_FILE, BATCH_SCHEDULE_FILE, the blocks that differ
+//	Calls:			runScheduleFile()
+//					openScheduleFile()
+//					readNextSchedule()
+//					closeScheduleFile()
+//					amortSchedule()
+//					getColumns()
+//					checkBlock()
+//	Parameters:		None
+//  Returns:		the number of blocks that differ
+//	History Log:	10/17/2026 written for the binary schedule test
+//					10/17/2026 broken lines get status blocks
+//----------------------------------------------------------------------------
+static int checkScheduleFile(void)
+{
+	static long long expected[BINARY_COLUMNS * MAX_MONTHS];
+	ScheduleFile schedules;
+	ScheduleView view;
+	FILE* file = fopen(BATCH_FILE, "w");
+	const AmortResult* loan = NULL;
+	size_t broken = 0;
+	int count = 0;
+	int failures = 0;
+	int i = 0;
+
+	if (file == NULL)
+	{
+		printf("  could not create %s\n", BATCH_FILE);
+		return ONE;
+	}
+	fprintf(file, "# the loans of the round trip\n");
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		if (i % BROKEN_EVERY == ZERO)
+		{
+			fprintf(file, "%s\n", brokenLines[i / BROKEN_EVERY %
+				(sizeof(brokenLines) / sizeof(brokenLines[0]))]);
+		}
+		fprintf(file, "P,%.3lf,%.2lf,,%d\n", loans[i].apr,
+			loans[i].principal, loans[i].months);
+	}
+	if (fclose(file) != ZERO ||
+		runScheduleFile(BATCH_FILE, BATCH_SCHEDULE_FILE, ARITHMETIC_DOUBLE) !=
+		EXIT_SUCCESS ||
+		openScheduleFile(&schedules, BATCH_SCHEDULE_FILE) != EXIT_SUCCESS)
+	{
+		printf("  could not run %s\n", BATCH_FILE);
+		return ONE;
+	}
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		broken = i / BROKEN_EVERY % (sizeof(brokenLines) /
+			sizeof(brokenLines[0]));
+		if (i % BROKEN_EVERY == ZERO &&
+			(readNextSchedule(&schedules, &view) != SCHEDULE_FOUND ||
+			view.header->rowCount != ZERO ||
+			view.header->status != brokenStatus[broken]))
+		{
+			printf("  no status block before loan %d\n", i);
+			failures++;
+		}
+		loan = &loans[i];
+		amortSchedule(loan, rows, MAX_MONTHS, &count);
+		getColumns(rows, count, expected);
+		failures += readNextSchedule(&schedules, &view) != SCHEDULE_FOUND ||
+			checkBlock(&view, i, toCents(loan->principal),
+			(int)floor(loan->apr * THOUSAND + 0.5), loan->months, expected,
+			count) != ZERO;
+	}
+	failures += readNextSchedule(&schedules, &view) != SCHEDULE_END;
+	closeScheduleFile(&schedules);
+	remove(BATCH_FILE);
+	remove(BATCH_SCHEDULE_FILE);
+	printf("  runScheduleFile() of %d loans: %d differ\n", TEST_LOANS,
+		failures);
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Binary schedule test
+//
+// Description:		Writes random loans' tables as binary schedule blocks,
+//					in doubles and in whole cents, maps the file and reads
+//					every block back in place to compare it with the rows
+//					it was written from; then does the same through
+//					runScheduleFile() from a batch file with broken lines
+//
+// Output:			How many blocks came back different
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every block matches, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initGrowthTable()
+//					makeLoans()
+//					checkRoundTrip()
+//					checkScheduleFile()
+//
+// History Log:		10/17/2026: written for the binary schedule test
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int failures = 0;
+
+	(void)argc;
+	(void)argv;
+	initGrowthTable();
+	makeLoans();
+	failures += checkRoundTrip();
+	failures += checkScheduleFile();
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,297 @@
+//----------------------------------------------------------------------------
+// File: CacheTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include "Amort.h"
+#include "AmortApi.h"
+#include "AmortGrowth.h"
+#include "AmortCents.h"
+#include "AmortCache.h"
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define MAX_MONTHS 360
+#define FIRST_PRINCIPAL 1000.0
+#define SEARCH_LOANS 100000
+//twice what the cache holds, so every set has to evict
+#define FILL_LOANS (2 * CACHE_SETS * CACHE_WAYS)
+
+//----------------------------------------------------------------------------
+//	Function:		makeRequest()
+//  Title:			Make request
+//	Description:	This function will fill a payment request
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		request		(AmortRequest*)
+//					apr			(double)
+//					principal	(double)
+//					months		(int)
+//					arithmetic	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the quote cache test
+//----------------------------------------------------------------------------
+static void makeRequest(AmortRequest* request, double apr, double principal,
+	int months, int arithmetic)
+{
+	request->mode = 'P';
+	request->apr = apr;
+	request->principal = principal;
+	request->payment = 0.0;
+	request->months = months;
+	request->arithmetic = arithmetic;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkQuote()
+//  Title:			Check quote
+//	Description:	This function will ask the cache for a quote and check
+//					the answer is amortCalculate()'s, field by field, and
+//					that the cache counted it as a hit or a miss as
+//					expected
+//	Input:			None
+//	Output:			what went wrong
+//	Calls:			getQuoteCacheStats()
+//					cachedCalculate()
+//					amortCalculate()
+//	Parameters:		request	(const AmortRequest*)
+//					hit		(int) TRUE when the quote should come from the
+//							cache
+//					what	(const char*) the case being checked
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the quote cache test
+//----------------------------------------------------------------------------
+static int checkQuote(const AmortRequest* request, int hit, const char* what)
+{
+	QuoteCacheStats before;
+	QuoteCacheStats after;
+	AmortResult cached;
+	AmortResult expected;
+	int failures = 0;
+
+	getQuoteCacheStats(&before);
+	cachedCalculate(request, &cached);
+	getQuoteCacheStats(&after);
+	amortCalculate(request, &expected);
+	if (cached.status != expected.status || cached.apr != expected.apr ||
+		cached.monthlyRate != expected.monthlyRate ||
+		cached.principal != expected.principal ||
+		cached.payment != expected.payment ||
+		cached.months != expected.months ||
+		cached.arithmetic != expected.arithmetic)
+	{
+		printf("  %s: the cache answered %.2lf instead of %.2lf\n", what,
+			cached.payment, expected.payment);
+		failures++;
+	}
+	if (after.hits - before.hits != (hit ? ONE : ZERO) ||
+		after.misses - before.misses != (hit ? ZERO : ONE))
+	{
+		printf("  %s: expected a %s\n", what, hit ? "hit" : "miss");
+		failures++;
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkKeys()
+//  Title:			Check keys
+//	Description:	This function will check that a repeated request and
+//					one that rounds to it are hits, that a request with any
+//					field changed is a miss, and that a request the cache
+//					cannot key is bypassed
+//	Input:			None
+//	Output:			what went wrong
+//	Calls:			makeRequest()
+//					checkQuote()
+//					getQuoteCacheStats()
+//					cachedCalculate()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the quote cache test
+//----------------------------------------------------------------------------
+static int checkKeys(void)
+{
+	QuoteCacheStats before;
+	QuoteCacheStats after;
+	AmortRequest request;
+	AmortResult result;
+	int failures = 0;
+
+	makeRequest(&request, 6.5, 250000.0, MAX_MONTHS, ARITHMETIC_DOUBLE);
+	failures += checkQuote(&request, FALSE, "first quote");
+	failures += checkQuote(&request, TRUE, "same quote");
+	makeRequest(&request, 6.52, 250000.004, MAX_MONTHS, ARITHMETIC_DOUBLE);
+	failures += checkQuote(&request, TRUE, "quote rounding to it");
+	makeRequest(&request, 6.5, 250000.01, MAX_MONTHS, ARITHMETIC_DOUBLE);
+	failures += checkQuote(&request, FALSE, "principal a cent more");
+	makeRequest(&request, 6.625, 250000.0, MAX_MONTHS, ARITHMETIC_DOUBLE);
+	failures += checkQuote(&request, FALSE, "APR an eighth more");
+	makeRequest(&request, 6.5, 250000.0, MAX_MONTHS - ONE, ARITHMETIC_DOUBLE);
+	failures += checkQuote(&request, FALSE, "a month less");
+	makeRequest(&request, 6.5, 250000.0, MAX_MONTHS, ARITHMETIC_CENTS);
+	failures += checkQuote(&request, FALSE, "whole cents");
+	failures += checkQuote(&request, TRUE, "whole cents again");
+	request.mode = 'L';
+	request.payment = 1500.0;
+	failures += checkQuote(&request, FALSE, "loan size");
+	makeRequest(&request, -1.0, 250000.0, MAX_MONTHS, ARITHMETIC_DOUBLE);
+	getQuoteCacheStats(&before);
+	cachedCalculate(&request, &result);
+	getQuoteCacheStats(&after);
+	if (after.bypassed - before.bypassed != ONE ||
+		result.status != AMORT_BAD_APR)
+	{
+		printf("  a negative APR was not bypassed\n");
+		failures++;
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkArithmetic()
+//  Title:			Check arithmetic
+//	Description:	This function will find a loan whose whole-cent payment
+//					is not its double one and check that the cache keeps
+//					the two apart in either order
+//	Input:			None
+//	Output:			what went wrong
+//	Calls:			makeRequest()
+//					amortCalculate()
+//					checkQuote()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the quote cache test
+//----------------------------------------------------------------------------
+static int checkArithmetic(void)
+{
+	AmortRequest doubles;
+	AmortRequest cents;
+	AmortResult doubleLoan;
+	AmortResult centsLoan;
+	int failures = 0;
+	int i = 0;
+
+	for (i = 0; i < SEARCH_LOANS; i++)
+	{
+		makeRequest(&doubles, 7.125, FIRST_PRINCIPAL + i, MAX_MONTHS,
+			ARITHMETIC_DOUBLE);
+		makeRequest(&cents, 7.125, FIRST_PRINCIPAL + i, MAX_MONTHS,
+			ARITHMETIC_CENTS);
+		amortCalculate(&doubles, &doubleLoan);
+		amortCalculate(&cents, &centsLoan);
+		if (doubleLoan.payment != centsLoan.payment)
+		{
+			break;
+		}
+	}
+	if (i == SEARCH_LOANS)
+	{
+		printf("  no loan has a cents payment apart from its double one\n");
+		return ONE;
+	}
+	failures += checkQuote(&doubles, FALSE, "double payment");
+	failures += checkQuote(&cents, FALSE, "cents payment of the same loan");
+	failures += checkQuote(&doubles, TRUE, "double payment again");
+	failures += checkQuote(&cents, TRUE, "cents payment again");
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkEviction()
+//  Title:			Check eviction
+//	Description:	This function will quote twice as many loans as the
+//					cache holds, check every answer and that the cache
+//					evicted and never held more than it has room for, then
+//					check the last loan quoted is still there
+//	Input:			None
+//	Output:			what went wrong
+//	Calls:			makeRequest()
+//					getQuoteCacheStats()
+//					cachedCalculate()
+//					amortCalculate()
+//					checkQuote()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the quote cache test
+//----------------------------------------------------------------------------
+static int checkEviction(void)
+{
+	QuoteCacheStats before;
+	QuoteCacheStats after;
+	AmortRequest request;
+	AmortResult cached;
+	AmortResult expected;
+	int wrong = 0;
+	int failures = 0;
+	int i = 0;
+
+	getQuoteCacheStats(&before);
+	for (i = 0; i < FILL_LOANS; i++)
+	{
+		makeRequest(&request, (double)(i % 240) / 8, FIRST_PRINCIPAL + i,
+			ONE + i % MAX_MONTHS, i % 2 ? ARITHMETIC_CENTS : ARITHMETIC_DOUBLE);
+		cachedCalculate(&request, &cached);
+		amortCalculate(&request, &expected);
+		wrong += cached.payment != expected.payment ||
+			cached.arithmetic != expected.arithmetic;
+	}
+	getQuoteCacheStats(&after);
+	if (wrong != ZERO)
+	{
+		printf("  %d of %d quotes were wrong\n", wrong, FILL_LOANS);
+		failures++;
+	}
+	if (after.evictions - before.evictions <= ZERO ||
+		after.entries > CACHE_SETS * CACHE_WAYS)
+	{
+		printf("  %lld evictions and %d entries after %d quotes\n",
+			after.evictions - before.evictions, after.entries, FILL_LOANS);
+		failures++;
+	}
+	failures += checkQuote(&request, TRUE, "last quote after evictions");
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Quote cache test
+//
+// Description:		Checks that cachedCalculate() answers what
+//					amortCalculate() does through hits, misses, evictions
+//					and requests that differ in one field or only in their
+//					arithmetic
+//
+// Output:			How many checks failed
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every check passes, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initGrowthTable()
+//					initQuoteCache()
+//					checkKeys()
+//					checkArithmetic()
+//					checkEviction()
+//
+// History Log:		10/17/2026: written for the quote cache
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int failures = 0;
+
+	(void)argc;
+	(void)argv;
+	initGrowthTable();
+	initQuoteCache();
+	failures += checkKeys();
+	failures += checkArithmetic();
+	failures += checkEviction();
+	printf("  quote cache: %d checks failed\n", failures);
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
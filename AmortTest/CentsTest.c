@@ -0,0 +1,276 @@
+//----------------------------------------------------------------------------
+// File: CentsTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <limits.h>
+#include "Amort.h"
+#include "AmortGrowth.h"
+#include "AmortCents.h"
+#define ONE 1
+#define ZERO 0
+#define HALF 0.5
+#define HUNDRED 100
+#define EIGHTHS_PER_POINT 8
+#define YEARLY_INTEREST_RATE 1200
+#define MAX_EIGHTHS 240
+#define MAX_MONTHS 360
+#define MIN_PRINCIPAL 100.0
+#define PRINCIPAL_SPREAD 50000.0
+#define TEST_LOANS 200000
+#define MAX_REPORTS 5
+
+//the loans both kinds of table are made for
+static long long principalCents[TEST_LOANS];
+static int aprEighths[TEST_LOANS];
+static int months[TEST_LOANS];
+static CentsRow centsRows[MAX_MONTHS];
+static unsigned long long seed = 88172645463325252ULL;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, so every run checks the same loans
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		a number in [0, 1)
+//	History Log:	10/17/2026 written for the whole-cent test
+//----------------------------------------------------------------------------
+static double nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (double)(seed >> 11) / 9007199254740992.0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeLoans()
+//  Title:			Make loans
+//	Description:	This function will draw the loans: APR in eighths from 0
+//					to 30%, terms from 1 to 360 months and principal spread
+//					evenly on a log scale from $100 to $5M
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//					toCents()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the whole-cent test
+//----------------------------------------------------------------------------
+static void makeLoans(void)
+{
+	int i = 0;
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		aprEighths[i] = (int)(nextRandom() * (MAX_EIGHTHS + ONE));
+		months[i] = ONE + (int)(nextRandom() * MAX_MONTHS);
+		principalCents[i] = toCents(MIN_PRINCIPAL *
+			pow(PRINCIPAL_SPREAD, nextRandom()));
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		report()
+//  Title:			Report
+//	Description:	This function will count a loan that failed a check,
+//					printing the first few
+//	Input:			None
+//	Output:			the loan and what was wrong with it
+//	Calls:			None
+//	Parameters:		failures	(int*) the count so far
+//					loan		(int)
+//					what		(const char*)
+//					value		(long long) what came out
+//					expected	(long long)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the whole-cent test
+//----------------------------------------------------------------------------
+static void report(int* failures, int loan, const char* what,
+	long long value, long long expected)
+{
+	if ((*failures)++ < MAX_REPORTS)
+	{
+		printf("  loan %d (%lld cents, %d eighths, %d months) %s: %lld "
+			"instead of %lld\n", loan, principalCents[loan], aprEighths[loan],
+			months[loan], what, value, expected);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkLoan()
+//  Title:			Check loan
+//	Description:	This function will make one loan's cents table and
+//					check it against the double arithmetic: its payment is
+//					within a cent of the one getPaymentAmount() gives, its
+//					principal paid adds up to the loan exactly, it ends at
+//					a zero balance within the term with no last payment
+//					above the level one, and every balance is within what
+//					rounding each month's interest to the cent can add up
+//					to, half a cent carried forward at the loan's rate, of
+//					the same payment run in doubles with nothing rounded.
+//					generateSchedule() levels its payment again every month
+//					and rounds it up, so its balances run ahead of a level
+//					payment's and are not the ones to compare with
+//	Input:			None
+//	Output:			the first few failures
+//	Calls:			getPaymentAmount()
+//					getPaymentCents()
+//					generateScheduleCents()
+//					toCents()
+//					report()
+//	Parameters:		loan		(int)
+//					failures	(int*) the count so far
+//					worst		(double*) the largest balance difference
+//  Returns:		void
+//	History Log:	10/17/2026 written for the whole-cent test
+//----------------------------------------------------------------------------
+static void checkLoan(int loan, int* failures, double* worst)
+{
+	double principal = (double)principalCents[loan] / HUNDRED;
+	double monthlyRate = ((double)aprEighths[loan] / EIGHTHS_PER_POINT) /
+		YEARLY_INTEREST_RATE;
+	long long payment = toCents(getPaymentAmount(months[loan], principal,
+		monthlyRate));
+	long long paymentCents = getPaymentCents(principalCents[loan],
+		aprEighths[loan], months[loan]);
+	double balance = (double)principalCents[loan];
+	double drift = 0.0;
+	double difference = 0.0;
+	long long paid = 0;
+	int count = 0;
+	int row = 0;
+
+	if (llabs(paymentCents - payment) > ONE)
+	{
+		report(failures, loan, "payment", paymentCents, payment);
+		return;
+	}
+	count = generateScheduleCents(principalCents[loan], paymentCents,
+		aprEighths[loan], months[loan], centsRows);
+	if (count <= ZERO || count > months[loan])
+	{
+		report(failures, loan, "rows", count, months[loan]);
+		return;
+	}
+	for (row = 0; row < count; row++)
+	{
+		paid += centsRows[row].principalPaid;
+	}
+	if (paid != principalCents[loan])
+	{
+		report(failures, loan, "principal paid", paid, principalCents[loan]);
+	}
+	if (centsRows[count - ONE].balance != ZERO)
+	{
+		report(failures, loan, "last balance",
+			centsRows[count - ONE].balance, ZERO);
+	}
+	if (centsRows[count - ONE].payment > paymentCents)
+	{
+		report(failures, loan, "last payment",
+			centsRows[count - ONE].payment, paymentCents);
+	}
+	for (row = 0; row < count - ONE; row++)
+	{
+		balance += balance * monthlyRate - (double)paymentCents;
+		drift = drift * (ONE + monthlyRate) + HALF;
+		difference = fabs((double)centsRows[row].balance - balance);
+		*worst = difference > *worst ? difference : *worst;
+		if (difference > drift + ONE)
+		{
+			report(failures, loan, "balance", centsRows[row].balance,
+				(long long)floor(balance + HALF));
+			return;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkLimit()
+//  Title:			Check limit
+//	Description:	This function will check that a principal past
+//					getBalanceLimit() gets no cents payment and no cents
+//					table instead of an overflowed one
+//	Input:			None
+//	Output:			what went wrong
+//	Calls:			getBalanceLimit()
+//					getPaymentCents()
+//					generateScheduleCents()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the whole-cent test
+//----------------------------------------------------------------------------
+static int checkLimit(void)
+{
+	long long limit = getBalanceLimit(MAX_EIGHTHS);
+	int failures = 0;
+
+	if (LLONG_MAX / MAX_EIGHTHS < limit * 2)
+	{
+		printf("  the balance limit %lld leaves no headroom\n", limit);
+		failures++;
+	}
+	if (getPaymentCents(limit + ONE, MAX_EIGHTHS, MAX_MONTHS) != ZERO ||
+		generateScheduleCents(limit + ONE, limit, MAX_EIGHTHS, MAX_MONTHS,
+		centsRows) != ZERO)
+	{
+		printf("  a principal past the limit still got cents\n");
+		failures++;
+	}
+	if (getPaymentCents(limit, MAX_EIGHTHS, MAX_MONTHS) <= ZERO)
+	{
+		printf("  a principal at the limit got no cents payment\n");
+		failures++;
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Cents arithmetic test
+//
+// Description:		Makes every random loan's table in whole cents, checks
+//					it is exact and stays within its rounding of the same
+//					loan worked in doubles, then checks the overflow limit
+//					of the cents arithmetic
+//
+// Output:			How many loans failed and the largest balance gap
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every loan passes, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initGrowthTable()
+//					makeLoans()
+//					checkLoan()
+//					checkLimit()
+//
+// History Log:		10/17/2026: written for the whole-cent test
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	double worst = 0.0;
+	int failures = 0;
+	int i = 0;
+
+	(void)argc;
+	(void)argv;
+	initGrowthTable();
+	makeLoans();
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		checkLoan(i, &failures, &worst);
+	}
+	printf("  cents against doubles: %d of %d loans fail, balances at most "
+		"%.2lf cents apart\n", failures, TEST_LOANS, worst);
+	failures += checkLimit();
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,228 @@
+//----------------------------------------------------------------------------
+// File: KernelTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "Amort.h"
+#include "AmortGrowth.h"
+#include "AmortSchedule.h"
+#define ONE 1
+#define ZERO 0
+#define HUNDRED 100
+#define MONTHPERCENT 1200
+#define MIN_PRINCIPAL 100.0
+#define PRINCIPAL_SPREAD 50000.0
+#define RANDOM_PRINCIPALS 24
+#define OFF_GRID_RATES 2000
+#define OFF_GRID_MAX_APR 60.0
+#define MAX_REPORTS 5
+
+//the terms generateSchedule() has a fixed-term kernel for
+static const int standardTerms[] = { 36, 48, 60, 72, 180, 360 };
+//a cent, odd cents and a billion dollars
+static const double fixedPrincipals[] = { 0.01, 123456.78, 1e9 };
+static ScheduleRow kernelRows[GROWTH_MAX_MONTHS];
+static ScheduleRow cursorRows[GROWTH_MAX_MONTHS];
+static unsigned long long seed = 88172645463325252ULL;
+static int reports = 0;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, the same on every platform
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		a number from 0 up to 1
+//	History Log:	10/17/2026 written for the fixed-term kernel test
+//----------------------------------------------------------------------------
+static double nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (double)(seed >> 11) / 9007199254740992.0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkLoan()
+//  Title:			Check loan
+//	Description:	This function will fill the table of one loan with
+//					generateSchedule(), which hands a standard term at a
+//					rate in the growth table to its fixed-term kernel, and
+//					again row by row from a ScheduleCursor, the generic
+//					path, and check the two are the same to the bit
+//	Input:			None
+//	Output:			the first loans that differ
+//	Calls:			getPaymentAmount()
+//					generateSchedule()
+//					initScheduleCursor()
+//					nextScheduleRow()
+//	Parameters:		principal	(double)
+//					monthlyRate	(double)
+//					months		(int)
+//  Returns:		1 when the tables differ, else 0
+//	History Log:	10/17/2026 written for the fixed-term kernel test
+//----------------------------------------------------------------------------
+static int checkLoan(double principal, double monthlyRate, int months)
+{
+	ScheduleCursor cursor;
+	double payment = getPaymentAmount(months, principal, monthlyRate);
+	int kernelCount = 0;
+	int cursorCount = 0;
+
+	kernelCount = generateSchedule(principal, payment, monthlyRate, months,
+		kernelRows);
+	initScheduleCursor(&cursor, principal, payment, monthlyRate, months);
+	while (cursorCount < months &&
+		nextScheduleRow(&cursor, &cursorRows[cursorCount]))
+	{
+		cursorCount++;
+	}
+	if (kernelCount == cursorCount && memcmp(kernelRows, cursorRows,
+		kernelCount * sizeof(ScheduleRow)) == ZERO)
+	{
+		return ZERO;
+	}
+	if (reports++ < MAX_REPORTS)
+	{
+		printf("  $%.2lf at %.6lf%% a month for %d months: %d rows, "
+			"cursor %d\n", principal, monthlyRate * HUNDRED, months,
+			kernelCount, cursorCount);
+	}
+	return ONE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkPrincipal()
+//  Title:			Check principal
+//	Description:	This function will check one principal at every APR
+//					eighth of the growth table and every term, so the
+//					standard terms go through their kernels and every other
+//					term past the switch
+//	Input:			None
+//	Output:			None
+//	Calls:			checkLoan()
+//	Parameters:		principal	(double)
+//					allTerms	(int) every term from 1, or only the
+//								standard ones
+//  Returns:		the number of tables that differ
+//	History Log:	10/17/2026 written for the fixed-term kernel test
+//----------------------------------------------------------------------------
+static int checkPrincipal(double principal, int allTerms)
+{
+	double monthlyRate = 0.0;
+	int failures = 0;
+	int eighths = 0;
+	int term = 0;
+
+	for (eighths = 0; eighths < GROWTH_RATES; eighths++)
+	{
+		//the rate amortCalculate() makes of an APR on the eighth grid
+		monthlyRate = ((double)eighths / GROWTH_STEPS_PER_POINT) /
+			MONTHPERCENT;
+		if (allTerms)
+		{
+			for (term = 1; term <= GROWTH_MAX_MONTHS; term++)
+			{
+				failures += checkLoan(principal, monthlyRate, term);
+			}
+			continue;
+		}
+		for (term = 0; term < (int)(sizeof(standardTerms) / sizeof(int));
+			term++)
+		{
+			failures += checkLoan(principal, monthlyRate,
+				standardTerms[term]);
+		}
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkOffGrid()
+//  Title:			Check off grid
+//	Description:	This function will check standard terms at random rates
+//					off the eighth grid and past the growth table, which
+//					must not reach a kernel and so must match the cursor
+//					too
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//					checkLoan()
+//	Parameters:		None
+//  Returns:		the number of tables that differ
+//	History Log:	10/17/2026 written for the fixed-term kernel test
+//----------------------------------------------------------------------------
+static int checkOffGrid(void)
+{
+	int failures = 0;
+	int term = 0;
+	int i = 0;
+	for (i = 0; i < OFF_GRID_RATES; i++)
+	{
+		for (term = 0; term < (int)(sizeof(standardTerms) / sizeof(int));
+			term++)
+		{
+			failures += checkLoan(roundToNearestCent(MIN_PRINCIPAL *
+				pow(PRINCIPAL_SPREAD, nextRandom())), nextRandom() *
+				OFF_GRID_MAX_APR / MONTHPERCENT, standardTerms[term]);
+		}
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Fixed-term kernel test
+//
+// Description:		Checks the tables generateSchedule() fills through the
+//					fixed-term kernels against the generic ScheduleCursor
+//					to the bit, at every APR eighth of the growth table and
+//					every standard term for fixed and random principals,
+//					every term for one principal, and rates the kernels
+//					must leave to the cursor
+//
+// Output:			How many tables differ
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every table matches, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initGrowthTable()
+//					checkPrincipal()
+//					nextRandom()
+//					checkOffGrid()
+//
+// History Log:		10/17/2026: written for the fixed-term kernels
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int failures = 0;
+	int i = 0;
+
+	(void)argc;
+	(void)argv;
+	initGrowthTable();
+	failures += checkPrincipal(fixedPrincipals[ONE], ONE);
+	for (i = 0; i < (int)(sizeof(fixedPrincipals) / sizeof(double)); i++)
+	{
+		failures += checkPrincipal(fixedPrincipals[i], ZERO);
+	}
+	for (i = 0; i < RANDOM_PRINCIPALS; i++)
+	{
+		failures += checkPrincipal(roundToNearestCent(MIN_PRINCIPAL *
+			pow(PRINCIPAL_SPREAD, nextRandom())), ZERO);
+	}
+	failures += checkOffGrid();
+	printf("  fixed-term kernels: %d tables differ from the cursor\n",
+		failures);
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,384 @@
+//----------------------------------------------------------------------------
+// File: QueryTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Amort.h"
+#include "AmortApi.h"
+#include "AmortGrowth.h"
+#include "AmortCents.h"
+#include "AmortQuery.h"
+#define ONE 1
+#define ZERO 0
+#define EIGHTHS_PER_POINT 8
+#define MAX_EIGHTHS 240
+#define MAX_MONTHS 360
+#define MONTHS_PER_YEAR 12
+#define MIN_PRINCIPAL 100.0
+#define PRINCIPAL_SPREAD 50000.0
+#define TEST_LOANS 500
+#define MAX_REPORTS 5
+
+//the loans every query is asked about
+static AmortRequest requests[TEST_LOANS];
+static AmortResult loans[TEST_LOANS];
+static ScheduleRow rows[MAX_MONTHS];
+static CentsRow centsRows[MAX_MONTHS];
+//the printed table of the loan being checked, in cents
+static long long payment[MAX_MONTHS];
+static long long principalPaid[MAX_MONTHS];
+static long long interestPaid[MAX_MONTHS];
+static long long balance[MAX_MONTHS];
+static unsigned long long seed = 88172645463325252ULL;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, so every run checks the same loans
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		a number in [0, 1)
+//	History Log:	10/17/2026 written for the schedule query test
+//----------------------------------------------------------------------------
+static double nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (double)(seed >> 11) / 9007199254740992.0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeLoans()
+//  Title:			Make loans
+//	Description:	This function will draw random payment requests: APR in
+//					eighths from 0 to 30%, terms from 1 to 360 months and
+//					principal spread evenly on a log scale from $100 to $5M
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//					roundToNearestCent()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the schedule query test
+//----------------------------------------------------------------------------
+static void makeLoans(void)
+{
+	int i = 0;
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		requests[i].mode = 'P';
+		requests[i].apr = (double)(int)(nextRandom() * (MAX_EIGHTHS + ONE)) /
+			EIGHTHS_PER_POINT;
+		requests[i].months = ONE + (int)(nextRandom() * MAX_MONTHS);
+		requests[i].principal = roundToNearestCent(MIN_PRINCIPAL *
+			pow(PRINCIPAL_SPREAD, nextRandom()));
+		requests[i].payment = 0.0;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeTable()
+//  Title:			Make table
+//	Description:	This function will make a loan's table the way
+//					printTable() makes it and keep its amounts in cents as
+//					they are printed
+//	Input:			None
+//	Output:			None
+//	Calls:			toAprEighths()
+//					generateScheduleCents()
+//					generateSchedule()
+//					toCents()
+//	Parameters:		loan	(const AmortResult*)
+//  Returns:		the number of rows
+//	History Log:	10/17/2026 written for the schedule query test
+//----------------------------------------------------------------------------
+static int makeTable(const AmortResult* loan)
+{
+	int aprEighths = 0;
+	int count = 0;
+	int i = 0;
+
+	if (loan->arithmetic == ARITHMETIC_CENTS &&
+		toAprEighths(loan->monthlyRate, &aprEighths))
+	{
+		count = generateScheduleCents(toCents(loan->principal),
+			toCents(loan->payment), aprEighths, loan->months, centsRows);
+		for (i = 0; i < count; i++)
+		{
+			payment[i] = centsRows[i].payment;
+			principalPaid[i] = centsRows[i].principalPaid;
+			interestPaid[i] = centsRows[i].interestPaid;
+			balance[i] = centsRows[i].balance;
+		}
+		return count;
+	}
+	count = generateSchedule(loan->principal, loan->payment,
+		loan->monthlyRate, loan->months, rows);
+	for (i = 0; i < count; i++)
+	{
+		payment[i] = toCents(rows[i].payment);
+		principalPaid[i] = toCents(rows[i].principalPaid);
+		interestPaid[i] = toCents(rows[i].interestPaid);
+		balance[i] = toCents(rows[i].balance);
+	}
+	return count;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		baselinePayment()
+//  Title:			Baseline payment
+//	Description:	This function will work out a level payment the way
+//					getPaymentAmount() did before the growth table, with
+//					pow(), rounded up to the cent
+//	Input:			None
+//	Output:			None
+//	Calls:			pow()
+//					roundToNextCent()
+//	Parameters:		months		(int)
+//					principal	(double)
+//					monthlyRate	(double)
+//  Returns:		the payment
+//	History Log:	10/17/2026 written for the schedule query test
+//----------------------------------------------------------------------------
+static double baselinePayment(int months, double principal,
+	double monthlyRate)
+{
+	if (monthlyRate == ZERO)
+	{
+		return roundToNextCent(principal / months);
+	}
+	return roundToNextCent(pow(ONE + monthlyRate, months) * principal *
+		monthlyRate / (pow(ONE + monthlyRate, months) - ONE));
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeBaselineTable()
+//  Title:			Make baseline table
+//	Description:	This function will make a loan's double table with the
+//					loop printTable() ran before any of the schedule code
+//					was written: every month the payment is levelled again
+//					over the months left, the last month pays off the
+//					balance with its interest, and without interest the
+//					payment goes to principal until the last month. The
+//					amounts are kept in cents as they are printed. It
+//					shares nothing with ScheduleCursor, so the queries are
+//					checked against more than the code they are built on
+//	Input:			None
+//	Output:			None
+//	Calls:			baselinePayment()
+//					roundToNextCent()
+//					toCents()
+//	Parameters:		loan	(const AmortResult*)
+//  Returns:		the number of rows
+//	History Log:	10/17/2026 written for the schedule query test
+//----------------------------------------------------------------------------
+static int makeBaselineTable(const AmortResult* loan)
+{
+	double loanBalance = loan->principal;
+	double tabPayment = loan->payment;
+	double principalPart = loan->payment;
+	double interestPart = 0.0;
+	int i = 0;
+
+	for (i = 0; i < loan->months; i++)
+	{
+		if (loan->monthlyRate == ZERO && i < loan->months - ONE)
+		{
+			loanBalance -= principalPart;
+		}
+		else if (loan->monthlyRate == ZERO)
+		{
+			principalPart = loanBalance;
+			tabPayment = loanBalance;
+			loanBalance = 0;
+		}
+		else if (i < loan->months - ONE)
+		{
+			tabPayment = baselinePayment(loan->months - i, loanBalance,
+				loan->monthlyRate);
+			interestPart = loanBalance * loan->monthlyRate;
+			principalPart = tabPayment - interestPart;
+			loanBalance -= principalPart;
+		}
+		else
+		{
+			interestPart = loanBalance * loan->monthlyRate;
+			principalPart = loanBalance;
+			tabPayment = roundToNextCent(principalPart + interestPart);
+			loanBalance = 0;
+		}
+		payment[i] = toCents(tabPayment);
+		principalPaid[i] = toCents(principalPart);
+		interestPaid[i] = toCents(interestPart);
+		balance[i] = toCents(loanBalance);
+	}
+	return loan->months;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkLoan()
+//  Title:			Check loan
+//	Description:	This function will build one loan's index, ask every
+//					query about it and compare the answers with the table
+//					last made: the payoff month, the balance before any
+//					payment and after every month, the principal and
+//					interest through every month and the totals of every
+//					whole year
+//	Input:			None
+//	Output:			the first few answers that differ
+//	Calls:			buildScheduleIndex()
+//					getPayoffMonth()
+//					getBalanceAfter()
+//					getPrincipalThrough()
+//					getInterestThrough()
+//					getScheduleTotals()
+//					freeScheduleIndex()
+//					toCents()
+//	Parameters:		loan	(int)
+//					count	(int) rows in the table
+//					table	(const char*) which table it is
+//  Returns:		the number of answers that differ
+//	History Log:	10/17/2026 written for the schedule query test
+//					10/17/2026 queries asked of an index, against any
+//					table
+//----------------------------------------------------------------------------
+static int checkLoan(int loan, int count, const char* table)
+{
+	static int reports = 0;
+	ScheduleIndex index;
+	ScheduleTotals totals;
+	long long principalSum = 0;
+	long long interestSum = 0;
+	long long paymentSum = 0;
+	int failures = 0;
+	int month = 0;
+	int last = 0;
+	int i = 0;
+
+	failures += buildScheduleIndex(&loans[loan], &index) != EXIT_SUCCESS;
+	failures += getPayoffMonth(&index) != count;
+	failures += toCents(getBalanceAfter(&index, ZERO)) !=
+		toCents(loans[loan].principal);
+	for (month = 1; month <= count; month++)
+	{
+		principalSum += principalPaid[month - ONE];
+		interestSum += interestPaid[month - ONE];
+		failures += toCents(getBalanceAfter(&index, month)) !=
+			balance[month - ONE];
+		failures += toCents(getPrincipalThrough(&index, month)) !=
+			principalSum;
+		failures += toCents(getInterestThrough(&index, month)) !=
+			interestSum;
+	}
+	for (month = 1; month <= count; month += MONTHS_PER_YEAR)
+	{
+		principalSum = 0;
+		interestSum = 0;
+		paymentSum = 0;
+		last = month + MONTHS_PER_YEAR - ONE < count ?
+			month + MONTHS_PER_YEAR - ONE : count;
+		for (i = month; i <= last; i++)
+		{
+			paymentSum += payment[i - ONE];
+			principalSum += principalPaid[i - ONE];
+			interestSum += interestPaid[i - ONE];
+		}
+		getScheduleTotals(&index, month, month + MONTHS_PER_YEAR - ONE,
+			&totals);
+		failures += toCents(totals.payment) != paymentSum ||
+			toCents(totals.principalPaid) != principalSum ||
+			toCents(totals.interestPaid) != interestSum ||
+			toCents(totals.balance) != balance[last - ONE];
+	}
+	freeScheduleIndex(&index);
+	if (failures > ZERO && reports++ < MAX_REPORTS)
+	{
+		printf("  loan %d ($%.2lf at %.3lf%% for %d months): %d answers "
+			"differ from the %s table\n", loan, loans[loan].principal,
+			loans[loan].apr, loans[loan].months, failures, table);
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkMode()
+//  Title:			Check mode
+//	Description:	This function will calculate every loan in one
+//					arithmetic and check its queries against the table
+//					printTable() makes, and a double loan's against the
+//					baseline loop too
+//	Input:			None
+//	Output:			how many loans had answers that differ
+//	Calls:			amortCalculate()
+//					makeTable()
+//					makeBaselineTable()
+//					checkLoan()
+//	Parameters:		arithmetic	(int) ARITHMETIC_DOUBLE or ARITHMETIC_CENTS
+//					name	(const char*)
+//  Returns:		the number of loans with answers that differ
+//	History Log:	10/17/2026 written for the schedule query test
+//					10/17/2026 checked against the baseline loop
+//----------------------------------------------------------------------------
+static int checkMode(int arithmetic, const char* name)
+{
+	int failures = 0;
+	int i = 0;
+	for (i = 0; i < TEST_LOANS; i++)
+	{
+		requests[i].arithmetic = arithmetic;
+		amortCalculate(&requests[i], &loans[i]);
+		if (checkLoan(i, makeTable(&loans[i]), "printed") != ZERO ||
+			(arithmetic == ARITHMETIC_DOUBLE &&
+			checkLoan(i, makeBaselineTable(&loans[i]), "baseline") != ZERO))
+		{
+			failures++;
+		}
+	}
+	printf("  %s tables: %d of %d loans differ\n", name, failures,
+		TEST_LOANS);
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Schedule query test
+//
+// Description:		Asks the schedule queries about random loans at every
+//					month and every whole year and compares the answers
+//					with the table printTable() would print, in doubles and
+//					in whole cents, and the double answers with the table
+//					the baseline printTable() loop prints
+//
+// Output:			How many loans got an answer the table does not show
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every answer matches, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initGrowthTable()
+//					makeLoans()
+//					checkMode()
+//
+// History Log:		10/17/2026: written for the schedule queries
+//					10/17/2026: checked against the baseline loop
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int failures = 0;
+
+	(void)argc;
+	(void)argv;
+	initGrowthTable();
+	makeLoans();
+	failures += checkMode(ARITHMETIC_DOUBLE, "double");
+	failures += checkMode(ARITHMETIC_CENTS, "cents");
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
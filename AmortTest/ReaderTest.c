@@ -0,0 +1,391 @@
+//----------------------------------------------------------------------------
+// File: ReaderTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <limits.h>
+#include "Amort.h"
+#include "AmortApi.h"
+#include "AmortGrowth.h"
+#include "AmortReader.h"
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define FIELD_COUNT 4
+#define TEST_LINES 200000
+#define LINE_SIZE 160
+#define NUMBER_SIZE 48
+#define MAX_REPORTS 5
+
+static const char modeKeys[] = "1Pp2Ll3Nn4Ii";
+static const char* blanks[] = { "", "", "", " ", "\t", "  " };
+//lines both readers take, with numbers where rounding the digits half up
+//and rounding the double scanf() reads do not agree, or that have more
+//digits than a double keeps
+static const char* fixedLines[] = {
+	"P,6,1.005,,12",
+	"P,6,2.675,,12",
+	"P,6,1.015,,12",
+	"P,6,100000.125,,360",
+	"P,6,1000.0049999999999999999,,12",
+	"P,6,1.00500000000000000001,,12",
+	"P,6.0625,1000,,12",
+	"P,0.06249999999999999999,1000,,12",
+	"P,6.1875,1000,,12",
+	"L,5,,1.005,12",
+	"N,5,1000,100.005,",
+	"I,,1000,90.015,12",
+	"P,6,1e3,,3.6e2",
+	"P,+6,+1000.,,+12",
+	"P, 6 ,\t1000 , ,12 ",
+	"p,6,.5e4,,12",
+	"P,6,123456789012.345,,360",
+	"P,6,99999999999999.995,,360" };
+//lines neither reader takes
+static const char* badLines[] = {
+	"",
+	"X,6,1000,,12",
+	"P,6,1000,,",
+	"P,6,1000,12",
+	"P,6,1000,,12,1",
+	"P,6,1000,,12x",
+	"P,6,1000,,12.5",
+	"P,6,1000,,0",
+	"P,6,1000,,361",
+	"P,-6,1000,,12",
+	"P,6,-1000,,12",
+	"L,6,,0,12",
+	"N,6,1000,1,",
+	"I,,1000,1,12" };
+//lines strtod() would read but parseLoanLine() must not
+static const char* strtodOnlyLines[] = {
+	"P,inf,1000,,12",
+	"P,6,infinity,,12",
+	"P,nan,1000,,12",
+	"P,6,1000,,nan",
+	"P,0x10,1000,,12",
+	"P,6,0x1p10,,12",
+	"P,6,1e16,,12",
+	"P,6,1000,,1e40",
+	"P,6,1000,,99999999999999999999",
+	"P,1e9,1000,,12" };
+static unsigned long long seed = 88172645463325252ULL;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, so every run reads the same lines
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		limit	(int)
+//  Returns:		a number from 0 to limit - 1
+//	History Log:	10/17/2026 written for the loan reader test
+//----------------------------------------------------------------------------
+static int nextRandom(int limit)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (int)((seed >> 11) % (unsigned long long)limit);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeNumber()
+//  Title:			Make number
+//	Description:	This function will write a random decimal the way
+//					people type them: a whole part, maybe a sign, leading
+//					zeros or an exponent, and up to a dozen places, often
+//					ending on a 5 just past the cents
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//	Parameters:		text		(char*) NUMBER_SIZE characters
+//					wholeLimit	(int) the whole part is below it
+//					minWhole	(int) and at least this
+//  Returns:		void
+//	History Log:	10/17/2026 written for the loan reader test
+//----------------------------------------------------------------------------
+static void makeNumber(char* text, int wholeLimit, int minWhole)
+{
+	char places[NUMBER_SIZE];
+	int count = nextRandom(13);
+	int i = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		places[i] = (char)('0' + nextRandom(10));
+	}
+	if (count >= 3 && nextRandom(3) == ZERO)
+	{
+		//half a cent, or half of a smaller place
+		places[2] = '5';
+		for (i = 3; i < count; i++)
+		{
+			places[i] = '0';
+		}
+	}
+	places[count] = '\0';
+	sprintf(text, "%s%s%d%s%s", nextRandom(10) == ZERO ? "+" : "",
+		nextRandom(10) == ZERO ? "00" : "",
+		minWhole + nextRandom(wholeLimit - minWhole),
+		count > ZERO || nextRandom(10) == ZERO ? "." : "", places);
+	if (nextRandom(8) == ZERO)
+	{
+		sprintf(text + strlen(text), "e%d", nextRandom(5) - 2);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeLine()
+//  Title:			Make line
+//	Description:	This function will write a random loan line with any of
+//					the mode keys, blanks around the commas and the field
+//					the mode calculates left empty or filled
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//					makeNumber()
+//	Parameters:		line	(char*) LINE_SIZE characters
+//  Returns:		void
+//	History Log:	10/17/2026 written for the loan reader test
+//----------------------------------------------------------------------------
+static void makeLine(char* line)
+{
+	char apr[NUMBER_SIZE];
+	char principal[NUMBER_SIZE];
+	char payment[NUMBER_SIZE];
+	char months[NUMBER_SIZE];
+
+	makeNumber(apr, 31, ZERO);
+	makeNumber(principal, 500000, ONE);
+	makeNumber(payment, 5000, ONE);
+	sprintf(months, "%d", ONE + nextRandom(360));
+	if (nextRandom(10) == ZERO)
+	{
+		strcat(months, ".0");
+	}
+	sprintf(line, "%s%c%s,%s%s%s,%s%s%s,%s%s%s,%s%s%s",
+		blanks[nextRandom(6)], modeKeys[nextRandom(12)], blanks[nextRandom(6)],
+		blanks[nextRandom(6)], nextRandom(4) == ZERO ? "" : apr,
+		blanks[nextRandom(6)], blanks[nextRandom(6)],
+		nextRandom(4) == ZERO ? "" : principal, blanks[nextRandom(6)],
+		blanks[nextRandom(6)], nextRandom(4) == ZERO ? "" : payment,
+		blanks[nextRandom(6)], blanks[nextRandom(6)],
+		nextRandom(4) == ZERO ? "" : months, blanks[nextRandom(6)]);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readWithStrtod()
+//  Title:			Read with strtod
+//	Description:	This function will split a line of the form
+//					"mode,apr,principal,payment,months" with strtod(), the
+//					way the console's scanf() reads each number, to give
+//					parseLoanLine() something independent to agree with
+//	Input:			None
+//	Output:			None
+//	Calls:			normalizeMode()
+//					strtod()
+//	Parameters:		line	(const char*)
+//					request	(AmortRequest*)
+//  Returns:		TRUE when the line holds a request, FALSE when it is
+//					malformed
+//	History Log:	10/17/2026 taken from the batch reader parseLoanLine()
+//					replaced
+//----------------------------------------------------------------------------
+static int readWithStrtod(const char* line, AmortRequest* request)
+{
+	double values[FIELD_COUNT] = { 0.0, 0.0, 0.0, 0.0 };
+	const char* cursor = line;
+	char* end = NULL;
+	int field = 0;
+
+	while (isspace((unsigned char)*cursor))
+	{
+		cursor++;
+	}
+	request->mode = normalizeMode(*cursor);
+	if (request->mode == ZERO)
+	{
+		return FALSE;
+	}
+	cursor++;
+	for (field = 0; field < FIELD_COUNT; field++)
+	{
+		while (*cursor == ' ' || *cursor == '\t')
+		{
+			cursor++;
+		}
+		if (*cursor != ',')
+		{
+			return FALSE;
+		}
+		cursor++;
+		values[field] = strtod(cursor, &end);
+		cursor = end;
+	}
+	while (isspace((unsigned char)*cursor))
+	{
+		cursor++;
+	}
+	if (*cursor != '\0' || values[3] != floor(values[3]) ||
+		fabs(values[3]) > INT_MAX)
+	{
+		return FALSE;
+	}
+	request->apr = values[0];
+	request->principal = values[1];
+	request->payment = values[2];
+	request->months = (int)values[3];
+	request->arithmetic = ARITHMETIC_DOUBLE;
+	return TRUE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkLine()
+//  Title:			Check line
+//	Description:	This function will read a line with parseLoanLine() and
+//					with readWithStrtod() and check both refuse it or both
+//					price it to the same loan
+//	Input:			None
+//	Output:			the first few lines that differ
+//	Calls:			readWithStrtod()
+//					parseLoanLine()
+//					getLoanRequest()
+//					amortCalculate()
+//	Parameters:		text	(const char*)
+//  Returns:		TRUE when the line was read the same both ways
+//	History Log:	10/17/2026 written for the loan reader test
+//----------------------------------------------------------------------------
+static int checkLine(const char* text)
+{
+	static int reports = 0;
+	AmortRequest reference;
+	AmortResult expected;
+	LoanLine line;
+	AmortRequest request;
+	AmortResult loan;
+	int same = TRUE;
+
+	expected.status = AMORT_BAD_FORMAT;
+	if (readWithStrtod(text, &reference))
+	{
+		amortCalculate(&reference, &expected);
+	}
+	parseLoanLine(text, text + strlen(text), &line);
+	loan.status = line.status;
+	if (line.status == AMORT_OK)
+	{
+		getLoanRequest(&line, &request);
+		amortCalculate(&request, &loan);
+	}
+	if ((expected.status == AMORT_OK) != (loan.status == AMORT_OK))
+	{
+		same = FALSE;
+	}
+	else if (loan.status == AMORT_OK)
+	{
+		same = loan.apr == expected.apr &&
+			loan.principal == expected.principal &&
+			loan.payment == expected.payment && loan.months == expected.months;
+	}
+	if (!same && reports++ < MAX_REPORTS)
+	{
+		printf("  \"%s\": %s %.3lf,%.2lf,%.2lf,%d, strtod() %s "
+			"%.3lf,%.2lf,%.2lf,%d\n", text, amortStatusText(loan.status),
+			loan.apr, loan.principal, loan.payment, loan.months,
+			expected.status == AMORT_OK ? "ok" : "refused", expected.apr,
+			expected.principal, expected.payment, expected.months);
+	}
+	return same;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkStrtodOnly()
+//  Title:			Check strtod only
+//	Description:	This function will check that parseLoanLine() refuses
+//					the lines only strtod() reads: infinities, NaNs, hex
+//					and numbers with more digits than the fields allow
+//	Input:			None
+//	Output:			the lines it took
+//	Calls:			parseLoanLine()
+//	Parameters:		None
+//  Returns:		the number of lines it took
+//	History Log:	10/17/2026 written for the loan reader test
+//----------------------------------------------------------------------------
+static int checkStrtodOnly(void)
+{
+	LoanLine line;
+	int failures = 0;
+	int i = 0;
+	for (i = 0; i < (int)(sizeof(strtodOnlyLines) / sizeof(char*)); i++)
+	{
+		if (parseLoanLine(strtodOnlyLines[i], strtodOnlyLines[i] +
+			strlen(strtodOnlyLines[i]), &line) != AMORT_BAD_FORMAT)
+		{
+			printf("  \"%s\" was read: %s\n", strtodOnlyLines[i],
+				amortStatusText(line.status));
+			failures++;
+		}
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Loan reader test
+//
+// Description:		Reads fixed, broken and random loan lines with
+//					parseLoanLine() and with the strtod() reader and checks
+//					they agree on every line both can read, then checks
+//					parseLoanLine() refuses what only strtod() reads
+//
+// Output:			How many lines were read differently
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every line agrees, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initGrowthTable()
+//					checkLine()
+//					makeLine()
+//					checkStrtodOnly()
+//
+// History Log:		10/17/2026: written for the loan reader
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	char text[LINE_SIZE];
+	int failures = 0;
+	int i = 0;
+
+	(void)argc;
+	(void)argv;
+	initGrowthTable();
+	for (i = 0; i < (int)(sizeof(fixedLines) / sizeof(char*)); i++)
+	{
+		failures += !checkLine(fixedLines[i]);
+	}
+	for (i = 0; i < (int)(sizeof(badLines) / sizeof(char*)); i++)
+	{
+		failures += !checkLine(badLines[i]);
+	}
+	for (i = 0; i < TEST_LINES; i++)
+	{
+		makeLine(text);
+		failures += !checkLine(text);
+	}
+	printf("  parseLoanLine() against strtod(): %d of %d lines differ\n",
+		failures, TEST_LINES + (int)((sizeof(fixedLines) +
+		sizeof(badLines)) / sizeof(char*)));
+	failures += checkStrtodOnly();
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
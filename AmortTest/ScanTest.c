@@ -0,0 +1,341 @@
+//----------------------------------------------------------------------------
+// File: ScanTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "Amort.h"
+#include "AmortGrowth.h"
+#include "AmortCents.h"
+#include "AmortScan.h"
+#define ONE 1
+#define ZERO 0
+#define HALF 0.5
+#define HUNDRED 100
+#define DAYS_PER_YEAR 365
+#define MAX_EIGHTHS 240
+#define EIGHTH_STEP 7
+#define TEST_THREADS 4
+#define MAX_REPORTS 5
+#define MAX_PERIODS (50 * SCAN_BLOCK + 1)
+//the rounding error, in cents, below which a loan's balances are
+//expected within a cent of the serial ones
+#define CONDITION_LIMIT 0.001
+
+static const int terms[] = { 1, 12, 60, 359, 360 };
+static const long long principals[] = { 1, 99999, 25000000, 100000000000LL };
+//periods on, just past and well past a block boundary, and a century of
+//days
+static const int longPeriods[] = { SCAN_BLOCK - ONE, SCAN_BLOCK,
+	SCAN_BLOCK + ONE, 3 * SCAN_BLOCK + ONE, DAYS_PER_YEAR * HUNDRED,
+	MAX_PERIODS };
+static const double longAprs[] = { 0.0, 0.125, 3.5, 7.25, 19.875 };
+static CentsRow scanRows[MAX_PERIODS];
+static CentsRow otherRows[MAX_PERIODS];
+
+//----------------------------------------------------------------------------
+//	Function:		serialScheduleCents()
+//  Title:			Serial schedule in cents
+//	Description:	This function will fill the table scanScheduleCents()
+//					is meant to give, one period after another: the
+//					unrounded balance times 1 + rate less the payment, each
+//					rounded to the nearest cent as it is written, and the
+//					row that gets under half a cent, or the last period,
+//					paying off what is left
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		principalCents	(long long)
+//					paymentCents	(long long)
+//					periodRate		(double)
+//					periods			(int)
+//					rows			(CentsRow*) room for periods rows
+//  Returns:		the number of rows filled
+//	History Log:	10/17/2026 written for the prefix scan test
+//----------------------------------------------------------------------------
+static int serialScheduleCents(long long principalCents,
+	long long paymentCents, double periodRate, int periods, CentsRow* rows)
+{
+	double balance = (double)principalCents;
+	long long previous = principalCents;
+	long long cents = 0;
+	int i = 0;
+
+	for (i = 0; i < periods; i++)
+	{
+		balance = (ONE + periodRate) * balance - (double)paymentCents;
+		rows[i].month = i + ONE;
+		if (!(balance >= HALF) || i == periods - ONE)
+		{
+			rows[i].interestPaid = (long long)floor(previous * periodRate +
+				HALF);
+			rows[i].principalPaid = previous;
+			rows[i].payment = previous + rows[i].interestPaid;
+			rows[i].balance = 0;
+			return i + ONE;
+		}
+		cents = (long long)floor(balance + HALF);
+		rows[i].payment = paymentCents;
+		rows[i].principalPaid = previous - cents;
+		rows[i].interestPaid = paymentCents - rows[i].principalPaid;
+		rows[i].balance = cents;
+		previous = cents;
+	}
+	return periods;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkRows()
+//  Title:			Check rows
+//	Description:	This function will check that every row of a table
+//					pays what it says, principal plus interest, and that
+//					the principal paid adds up to the loan
+//	Input:			None
+//	Output:			what went wrong
+//	Calls:			None
+//	Parameters:		principalCents	(long long)
+//					rows			(const CentsRow*)
+//					count			(int)
+//					what			(const char*) the loan being checked
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the prefix scan test
+//----------------------------------------------------------------------------
+static int checkRows(long long principalCents, const CentsRow* rows,
+	int count, const char* what)
+{
+	long long paid = 0;
+	int i = 0;
+	for (i = 0; i < count; i++)
+	{
+		if (rows[i].month != i + ONE ||
+			rows[i].payment != rows[i].principalPaid + rows[i].interestPaid)
+		{
+			printf("  %s: row %d does not add up\n", what, i + ONE);
+			return ONE;
+		}
+		paid += rows[i].principalPaid;
+	}
+	if (count <= ZERO || paid != principalCents ||
+		rows[count - ONE].balance != ZERO)
+	{
+		printf("  %s: %d rows pay %lld of %lld\n", what, count, paid,
+			principalCents);
+		return ONE;
+	}
+	return ZERO;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkMonthly()
+//  Title:			Check monthly
+//	Description:	This function will scan monthly loans at the payment
+//					getPaymentCents() gives, check every table adds up and
+//					check the tables without interest are
+//					generateScheduleCents()'s row for row. With interest
+//					the two part by design: generateScheduleCents() rounds
+//					each month's interest into the balance and the scan
+//					follows the unrounded balance, so they can even end a
+//					row apart
+//	Input:			None
+//	Output:			what went wrong
+//	Calls:			getPaymentCents()
+//					generateScheduleCents()
+//					scanScheduleCents()
+//					checkRows()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the prefix scan test
+//----------------------------------------------------------------------------
+static int checkMonthly(void)
+{
+	char what[HUNDRED];
+	long long payment = 0;
+	int failures = 0;
+	int eighths = 0;
+	int term = 0;
+	int loan = 0;
+	int centsCount = 0;
+	int scanCount = 0;
+
+	for (eighths = 0; eighths <= MAX_EIGHTHS; eighths += EIGHTH_STEP)
+	{
+		for (term = 0; term < (int)(sizeof(terms) / sizeof(int)); term++)
+		{
+			for (loan = 0; loan < (int)(sizeof(principals) /
+				sizeof(long long)); loan++)
+			{
+				sprintf(what, "%lld cents at %d eighths for %d months",
+					principals[loan], eighths, terms[term]);
+				payment = getPaymentCents(principals[loan], eighths,
+					terms[term]);
+				centsCount = generateScheduleCents(principals[loan], payment,
+					eighths, terms[term], otherRows);
+				if (centsCount == ZERO)
+				{
+					//past getBalanceLimit(), no cents table to compare
+					continue;
+				}
+				scanCount = scanScheduleCents(principals[loan], payment,
+					(double)eighths / CENTS_RATE_SCALE, terms[term], scanRows,
+					TEST_THREADS);
+				failures += checkRows(principals[loan], scanRows, scanCount,
+					what);
+				if (eighths == ZERO && (scanCount != centsCount ||
+					memcmp(scanRows, otherRows, scanCount * sizeof(CentsRow))))
+				{
+					printf("  %s: %d scanned rows, %d cents rows\n", what,
+						scanCount, centsCount);
+					failures++;
+				}
+			}
+		}
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkLong()
+//  Title:			Check long
+//	Description:	This function will scan daily loans of up to 50 blocks
+//					on one thread and on TEST_THREADS and check the two
+//					tables are the same to the byte. A loan whose principal
+//					grown over its periods is under CONDITION_LIMIT cents
+//					of rounding error must end on the row
+//					serialScheduleCents() ends on, every balance within a
+//					cent of it. A block starts from the closed-form
+//					balance, not from the previous block's last row, so
+//					where an unrounded balance sits within that error of a
+//					half cent the two round it apart. Past the limit the
+//					payment cancels a principal grown beyond a double's
+//					digits in either form and only the sums are checked
+//	Input:			None
+//	Output:			what went wrong, and how many balances were a cent
+//					apart
+//	Calls:			roundToOneEighth()
+//					getPaymentAmount()
+//					toCents()
+//					scanScheduleCents()
+//					exp()
+//					log1p()
+//					serialScheduleCents()
+//					checkRows()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the prefix scan test
+//----------------------------------------------------------------------------
+static int checkLong(void)
+{
+	char what[HUNDRED];
+	long long principal = 0;
+	long long payment = 0;
+	long long rows = 0;
+	long long cents = 0;
+	double rate = 0.0;
+	int failures = 0;
+	int reports = 0;
+	int count = 0;
+	int serialCount = 0;
+	int conditioned = 0;
+	int periods = 0;
+	int apr = 0;
+	int i = 0;
+
+	for (periods = 0; periods < (int)(sizeof(longPeriods) / sizeof(int));
+		periods++)
+	{
+		for (apr = 0; apr < (int)(sizeof(longAprs) / sizeof(double)); apr++)
+		{
+			sprintf(what, "%d periods at %.3lf%%", longPeriods[periods],
+				longAprs[apr]);
+			principal = 1234567890LL + periods * 1000003LL + apr;
+			rate = roundToOneEighth(longAprs[apr]) /
+				((double)HUNDRED * DAYS_PER_YEAR);
+			payment = toCents(getPaymentAmount(longPeriods[periods],
+				(double)principal / HUNDRED, rate));
+			count = scanScheduleCents(principal, payment, rate,
+				longPeriods[periods], scanRows, ONE);
+			failures += checkRows(principal, scanRows, count, what);
+			if (scanScheduleCents(principal, payment, rate,
+				longPeriods[periods], otherRows, TEST_THREADS) != count ||
+				memcmp(scanRows, otherRows, count * sizeof(CentsRow)))
+			{
+				printf("  %s: %d threads changed the table\n", what,
+					TEST_THREADS);
+				failures++;
+			}
+			conditioned = principal * exp(longPeriods[periods] * log1p(rate)) *
+				DBL_EPSILON < CONDITION_LIMIT;
+			if (!conditioned)
+			{
+				continue;
+			}
+			serialCount = serialScheduleCents(principal, payment, rate,
+				longPeriods[periods], otherRows);
+			if (serialCount != count)
+			{
+				printf("  %s: %d scanned rows, %d serial rows\n", what,
+					count, serialCount);
+				failures++;
+				continue;
+			}
+			for (i = 0; i < count; i++)
+			{
+				if (scanRows[i].balance == otherRows[i].balance)
+				{
+					continue;
+				}
+				cents++;
+				if (llabs(scanRows[i].balance - otherRows[i].balance) > ONE &&
+					reports++ < MAX_REPORTS)
+				{
+					printf("  %s: row %d balance %lld, serial %lld\n", what,
+						i + ONE, scanRows[i].balance, otherRows[i].balance);
+					failures++;
+				}
+			}
+			rows += count;
+		}
+	}
+	printf("  prefix scan: %lld of %lld balances a cent from the serial "
+		"ones\n", cents, rows);
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Prefix scan test
+//
+// Description:		Checks scanScheduleCents() against
+//					generateScheduleCents() for monthly loans and against
+//					the serial recurrence for long daily ones, and that the
+//					thread count never changes a table
+//
+// Output:			How many checks failed
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every check passes, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initGrowthTable()
+//					checkMonthly()
+//					checkLong()
+//
+// History Log:		10/17/2026: written for the prefix scan
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int failures = 0;
+
+	(void)argc;
+	(void)argv;
+	initGrowthTable();
+	failures += checkMonthly();
+	failures += checkLong();
+	printf("  prefix scan: %d checks failed\n", failures);
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------
+// File: SheetTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "Amort.h"
+#include "AmortApi.h"
+#include "AmortCents.h"
+#include "AmortSheet.h"
+#define ONE 1
+#define ZERO 0
+#define HUNDRED 100
+#define EIGHTHS_PER_POINT 8
+#define MONTHPERCENT 1200
+#define TEST_THREADS 4
+#define RANDOM_PRINCIPALS 6
+#define MAX_PRINCIPAL_CENTS 1e11
+#define CALCULATED_CELLS 20000
+#define MAX_REPORTS 5
+
+//a cent, the default sheet, odd cents, a billion dollars, and two whose
+//sheets have a payment the carried growth factor puts a cent off, which
+//buildRateSheet() must hand to getPaymentAmount()
+static const long long principals[] = { 1, SHEET_PRINCIPAL * HUNDRED,
+	12345678, 100000000000LL, 39100390147LL, 12024744213LL };
+static unsigned long long seed = 88172645463325252ULL;
+static int reports = 0;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, the same on every platform
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		a number from 0 up to 1
+//	History Log:	10/17/2026 written for the rate sheet test
+//----------------------------------------------------------------------------
+static double nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (double)(seed >> 11) / 9007199254740992.0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkSheet()
+//  Title:			Check sheet
+//	Description:	This function will build the sheet of one principal up
+//					to SHEET_APR_LIMIT on one thread and on TEST_THREADS,
+//					check the two are the same, check every cell against
+//					getPaymentAmount() at the rate amortCalculate() makes
+//					of the APR, and check random cells against the payment
+//					amortCalculate() itself gives
+//	Input:			None
+//	Output:			the first cells that differ
+//	Calls:			buildRateSheet()
+//					getPaymentAmount()
+//					toCents()
+//					getSheetPayment()
+//					nextRandom()
+//					amortCalculate()
+//					freeRateSheet()
+//	Parameters:		principalCents	(long long)
+//  Returns:		the number of cells that differ
+//	History Log:	10/17/2026 written for the rate sheet test
+//----------------------------------------------------------------------------
+static int checkSheet(long long principalCents)
+{
+	RateSheet sheet;
+	RateSheet threaded;
+	AmortRequest request;
+	AmortResult loan;
+	double principal = (double)principalCents / HUNDRED;
+	long long expected = 0;
+	long long got = 0;
+	int maxEighths = SHEET_APR_LIMIT * EIGHTHS_PER_POINT;
+	int failures = 0;
+	int k = 0;
+	int n = 0;
+	int i = 0;
+
+	if (buildRateSheet(&sheet, principalCents, maxEighths, ONE) !=
+		EXIT_SUCCESS)
+	{
+		printf("  no memory for the sheet of %lld cents\n", principalCents);
+		return ONE;
+	}
+	if (buildRateSheet(&threaded, principalCents, maxEighths,
+		TEST_THREADS) != EXIT_SUCCESS || memcmp(sheet.payments,
+		threaded.payments, (size_t)sheet.aprRows * SHEET_MONTHS *
+		sizeof(long long)) != ZERO)
+	{
+		printf("  %lld cents: %d threads changed the sheet\n",
+			principalCents, TEST_THREADS);
+		failures++;
+	}
+	freeRateSheet(&threaded);
+	for (k = 0; k <= maxEighths; k++)
+	{
+		for (n = 1; n <= SHEET_MONTHS; n++)
+		{
+			expected = toCents(getPaymentAmount(n, principal,
+				((double)k / EIGHTHS_PER_POINT) / MONTHPERCENT));
+			got = getSheetPayment(&sheet, k, n);
+			if (got != expected && failures++ < MAX_REPORTS &&
+				reports++ < MAX_REPORTS)
+			{
+				printf("  %lld cents at %d eighths for %d months: %lld, "
+					"getPaymentAmount() %lld\n", principalCents, k, n, got,
+					expected);
+			}
+		}
+	}
+	request.mode = 'P';
+	request.principal = principal;
+	request.payment = 0.0;
+	request.arithmetic = ARITHMETIC_DOUBLE;
+	for (i = 0; i < CALCULATED_CELLS; i++)
+	{
+		k = (int)(nextRandom() * (maxEighths + ONE));
+		n = ONE + (int)(nextRandom() * SHEET_MONTHS);
+		request.apr = (double)k / EIGHTHS_PER_POINT;
+		request.months = n;
+		if (amortCalculate(&request, &loan) == AMORT_OK &&
+			getSheetPayment(&sheet, k, n) != toCents(loan.payment) &&
+			failures++ < MAX_REPORTS && reports++ < MAX_REPORTS)
+		{
+			printf("  %lld cents at %d eighths for %d months: %lld, "
+				"amortCalculate() %lld\n", principalCents, k, n,
+				getSheetPayment(&sheet, k, n), toCents(loan.payment));
+		}
+	}
+	if (getSheetPayment(&sheet, -ONE, ONE) != -ONE ||
+		getSheetPayment(&sheet, sheet.aprRows, ONE) != -ONE ||
+		getSheetPayment(&sheet, ZERO, ZERO) != -ONE ||
+		getSheetPayment(&sheet, ZERO, SHEET_MONTHS + ONE) != -ONE)
+	{
+		printf("  %lld cents: a cell outside the sheet was found\n",
+			principalCents);
+		failures++;
+	}
+	freeRateSheet(&sheet);
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Rate sheet test
+//
+// Description:		Checks every payment of rate sheets for fixed and
+//					random principals against getPaymentAmount() and
+//					amortCalculate(), and that the thread count never
+//					changes a sheet
+//
+// Output:			How many cells differ
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every cell matches, or EXIT_FAILURE
+// Called By:		None
+// Calls:			checkSheet()
+//					nextRandom()
+//
+// History Log:		10/17/2026: written for the rate sheet
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int failures = 0;
+	int i = 0;
+
+	(void)argc;
+	(void)argv;
+	for (i = 0; i < (int)(sizeof(principals) / sizeof(long long)); i++)
+	{
+		failures += checkSheet(principals[i]);
+	}
+	for (i = 0; i < RANDOM_PRINCIPALS; i++)
+	{
+		//spread evenly over the powers of 10 up to a billion dollars
+		failures += checkSheet((long long)pow(MAX_PRINCIPAL_CENTS,
+			nextRandom()));
+	}
+	printf("  rate sheet: %d cells differ\n", failures);
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
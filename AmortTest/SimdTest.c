@@ -0,0 +1,263 @@
+//----------------------------------------------------------------------------
+// File: SimdTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Amort.h"
+#include "AmortGrowth.h"
+#include "AmortCents.h"
+#include "AmortSimd.h"
+#define ONE 1
+#define ZERO 0
+#define HALF 0.5
+#define EIGHT 8
+#define EIGHTHS_PER_POINT 8
+#define MAX_EIGHTHS 240
+#define MAX_MONTHS 360
+#define MIN_PRINCIPAL 100.0
+#define PRINCIPAL_SPREAD 50000.0
+#define YEARLY_INTEREST_RATE 1200
+#define OFF_GRID_SHARE 0.05
+#define OFF_GRID_STEP 0.1
+#define TEST_CASES 200000
+#define MAX_REPORTS 5
+
+//the loans every kernel is checked on, one column per field
+static int months[TEST_CASES];
+static double principal[TEST_CASES];
+static double payment[TEST_CASES];
+static double monthlyRate[TEST_CASES];
+static double results[TEST_CASES];
+static int monthResults[TEST_CASES];
+//what the scalar functions give for them
+static double expectedPayment[TEST_CASES];
+static double expectedLoan[TEST_CASES];
+static int expectedMonths[TEST_CASES];
+static double expectedApr[TEST_CASES];
+static unsigned long long seed = 88172645463325252ULL;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, so every run checks the same loans
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		a number in [0, 1)
+//	History Log:	10/17/2026 written for the SIMD kernel test
+//----------------------------------------------------------------------------
+static double nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (double)(seed >> 11) / 9007199254740992.0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeCases()
+//  Title:			Make cases
+//	Description:	This function will draw the loans: APR in eighths from 0
+//					to 30%, terms from 1 to 360 months, principal spread
+//					evenly on a log scale from $100 to $5M and the payment
+//					the menu would calculate for them, a few of them moved
+//					off the grid so the APR solver has to work for it
+//	Input:			None
+//	Output:			None
+//	Calls:			nextRandom()
+//					roundToNearestCent()
+//					getPaymentAmount()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the SIMD kernel test
+//----------------------------------------------------------------------------
+static void makeCases(void)
+{
+	int i = 0;
+	for (i = 0; i < TEST_CASES; i++)
+	{
+		monthlyRate[i] = ((double)(int)(nextRandom() * (MAX_EIGHTHS + ONE)) /
+			EIGHTHS_PER_POINT) / YEARLY_INTEREST_RATE;
+		months[i] = ONE + (int)(nextRandom() * MAX_MONTHS);
+		principal[i] = roundToNearestCent(MIN_PRINCIPAL *
+			pow(PRINCIPAL_SPREAD, nextRandom()));
+		payment[i] = getPaymentAmount(months[i], principal[i], monthlyRate[i]);
+		if (nextRandom() < OFF_GRID_SHARE)
+		{
+			payment[i] = roundToNearestCent(payment[i] *
+				(ONE + OFF_GRID_STEP * nextRandom()));
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeExpected()
+//  Title:			Make expected
+//	Description:	This function will work out every loan with the scalar
+//					functions the kernels have to agree with
+//	Input:			None
+//	Output:			None
+//	Calls:			getPaymentAmount()
+//					getLoanAmount()
+//					getNumberOfMonths()
+//					getInterestRate()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the SIMD kernel test
+//----------------------------------------------------------------------------
+static void makeExpected(void)
+{
+	int i = 0;
+	for (i = 0; i < TEST_CASES; i++)
+	{
+		expectedPayment[i] = getPaymentAmount(months[i], principal[i],
+			monthlyRate[i]);
+		expectedLoan[i] = getLoanAmount(months[i], payment[i], monthlyRate[i]);
+		expectedMonths[i] = getNumberOfMonths(principal[i], payment[i],
+			monthlyRate[i]);
+		expectedApr[i] = getInterestRate(principal[i], payment[i], months[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkAmounts()
+//  Title:			Check amounts
+//	Description:	This function will count the loans whose amount from an
+//					array kernel is not the scalar amount to the cent,
+//					printing the first few and the count
+//	Input:			None
+//	Output:			the loans that differ
+//	Calls:			toCents()
+//	Parameters:		name		(const char*)
+//					expected	(const double*) from the scalar function
+//  Returns:		the number of loans that differ
+//	History Log:	10/17/2026 written for the SIMD kernel test
+//----------------------------------------------------------------------------
+static int checkAmounts(const char* name, const double* expected)
+{
+	int failures = 0;
+	int i = 0;
+	for (i = 0; i < TEST_CASES; i++)
+	{
+		if (toCents(results[i]) != toCents(expected[i]) &&
+			failures++ < MAX_REPORTS)
+		{
+			printf("  %s loan %d: %.2lf instead of %.2lf\n", name, i,
+				results[i], expected[i]);
+		}
+	}
+	printf("  %s: %d of %d differ\n", name, failures, TEST_CASES);
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkLevel()
+//  Title:			Check level
+//	Description:	This function will run every array kernel at one SIMD
+//					level and compare each loan with the scalar function:
+//					payments and loan sizes to the cent, terms to the month
+//					and APRs to the eighth
+//	Input:			None
+//	Output:			a line per kernel
+//	Calls:			setSimdLevel()
+//					getPaymentAmountArray()
+//					getLoanAmountArray()
+//					getNumberOfMonthsArray()
+//					getInterestRateArray()
+//					checkAmounts()
+//	Parameters:		level	(int) SIMD_NONE or SIMD_AVX2
+//  Returns:		the number of loans that differ
+//	History Log:	10/17/2026 written for the SIMD kernel test
+//----------------------------------------------------------------------------
+static int checkLevel(int level)
+{
+	int failures = 0;
+	int differ = 0;
+	int i = 0;
+
+	printf("SIMD level %d\n", setSimdLevel(level));
+	getPaymentAmountArray(months, principal, monthlyRate, results, TEST_CASES);
+	failures += checkAmounts("getPaymentAmountArray", expectedPayment);
+
+	getLoanAmountArray(months, payment, monthlyRate, results, TEST_CASES);
+	failures += checkAmounts("getLoanAmountArray", expectedLoan);
+
+	getNumberOfMonthsArray(principal, payment, monthlyRate, monthResults,
+		TEST_CASES);
+	for (i = 0; i < TEST_CASES; i++)
+	{
+		if (monthResults[i] != expectedMonths[i] && differ++ < MAX_REPORTS)
+		{
+			printf("  getNumberOfMonthsArray loan %d: %d instead of %d\n", i,
+				monthResults[i], expectedMonths[i]);
+		}
+	}
+	printf("  getNumberOfMonthsArray: %d of %d differ\n", differ,
+		TEST_CASES);
+	failures += differ;
+
+	getInterestRateArray(principal, payment, months, results, TEST_CASES);
+	differ = 0;
+	for (i = 0; i < TEST_CASES; i++)
+	{
+		if (floor(results[i] * EIGHT + HALF) !=
+			floor(expectedApr[i] * EIGHT + HALF) && differ++ < MAX_REPORTS)
+		{
+			printf("  getInterestRateArray loan %d: %.3lf instead of %.3lf\n",
+				i, results[i], expectedApr[i]);
+		}
+	}
+	printf("  getInterestRateArray: %d of %d differ\n", differ, TEST_CASES);
+	failures += differ;
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			SIMD kernel test
+//
+// Description:		Checks every array kernel in AmortSimd.h against the
+//					scalar function it stands for, once on the scalar path
+//					and once on the AVX2 kernels when the processor has
+//					them, over the same random loans on every run
+//
+// Output:			How many loans each kernel got wrong
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every kernel agrees, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initGrowthTable()
+//					makeCases()
+//					makeExpected()
+//					checkLevel()
+//
+// History Log:		10/17/2026: written for the SIMD kernel test
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int failures = 0;
+
+	(void)argc;
+	(void)argv;
+	initGrowthTable();
+	makeCases();
+	makeExpected();
+	failures += checkLevel(SIMD_NONE);
+	if (setSimdLevel(SIMD_AVX2) == SIMD_AVX2)
+	{
+		failures += checkLevel(SIMD_AVX2);
+	}
+	else
+	{
+		printf("No AVX2 on this processor; only the scalar path was "
+			"checked\n");
+	}
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
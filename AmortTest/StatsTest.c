@@ -0,0 +1,367 @@
+//----------------------------------------------------------------------------
+// File: StatsTest.c
+// Functions:
+//		int main(int argc, char *argv[])
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Amort.h"
+#include "AmortApi.h"
+#include "AmortStats.h"
+#include "AmortParallel.h"
+#define ONE 1
+#define ZERO 0
+#define TEST_SAMPLES 200000
+#define TEST_THREADS 4
+#define TEST_GRAIN 1024
+#define TEST_OP STATS_RATE
+#define TEST_PAYMENTS 1000
+#define MAX_REPORTS 5
+//latencies are drawn up to 2 to this power, past the last bucket
+#define SAMPLE_BITS 44
+#define FRACTIONS 9
+
+static const double fractions[FRACTIONS] = { 0.0, 0.001, 0.25, 0.5, 0.9,
+	0.99, 0.999, 0.9999, 1.0 };
+static long long samples[TEST_SAMPLES];
+static long long sorted[TEST_SAMPLES];
+static long long lows[STATS_BUCKETS + ONE];
+static unsigned long long seed = 88172645463325252ULL;
+
+//----------------------------------------------------------------------------
+//	Function:		nextRandom()
+//  Title:			Next random
+//	Description:	This function will give the next number of a xorshift
+//					generator, the same on every platform
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		64 random bits
+//	History Log:	10/17/2026 written for the stats test
+//----------------------------------------------------------------------------
+static unsigned long long nextRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return seed;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		compareNanos()
+//  Title:			Compare nanos
+//	Description:	This function will order two latencies for qsort()
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		left	(const void*)
+//					right	(const void*)
+//  Returns:		-1, 0 or 1
+//	History Log:	10/17/2026 written for the stats test
+//----------------------------------------------------------------------------
+static int compareNanos(const void* left, const void* right)
+{
+	long long a = *(const long long*)left;
+	long long b = *(const long long*)right;
+	return a < b ? -ONE : a > b;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeSamples()
+//  Title:			Make samples
+//	Description:	This function will fill the samples with the edges of
+//					every bucket, a latency just under each edge, a
+//					negative one, and random latencies spread evenly over
+//					the powers of 2 up to past the last bucket
+//	Input:			None
+//	Output:			None
+//	Calls:			getStatsBucketLow()
+//					nextRandom()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the stats test
+//----------------------------------------------------------------------------
+static void makeSamples(void)
+{
+	int count = 0;
+	int bucket = 0;
+	samples[count++] = -ONE;
+	for (bucket = 0; bucket < STATS_BUCKETS; bucket++)
+	{
+		samples[count++] = getStatsBucketLow(bucket);
+		samples[count++] = getStatsBucketLow(bucket) - ONE;
+	}
+	while (count < TEST_SAMPLES)
+	{
+		samples[count++] = (long long)(nextRandom() >>
+			(64 - ONE - (int)(nextRandom() % SAMPLE_BITS)));
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		findBucket()
+//  Title:			Find bucket
+//	Description:	This function will find the bucket a latency belongs
+//					in from the bucket edges alone, by bisection: the last
+//					bucket whose lowest latency is not above it
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		nanos	(long long) not negative
+//  Returns:		the bucket
+//	History Log:	10/17/2026 written for the stats test
+//----------------------------------------------------------------------------
+static int findBucket(long long nanos)
+{
+	int low = 0;
+	int high = STATS_BUCKETS;
+	int middle = 0;
+	while (high - low > ONE)
+	{
+		middle = (low + high) / 2;
+		if (lows[middle] <= nanos)
+		{
+			low = middle;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return low;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkEdges()
+//  Title:			Check edges
+//	Description:	This function will check the buckets start at 0, go up
+//					one latency at a time below STATS_SUB_COUNT and are
+//					never wider than 1 / STATS_SUB_COUNT of their lowest
+//					latency after that
+//	Input:			None
+//	Output:			the first bucket that is wrong
+//	Calls:			getStatsBucketLow()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the stats test
+//----------------------------------------------------------------------------
+static int checkEdges(void)
+{
+	int bucket = 0;
+	for (bucket = 0; bucket < STATS_BUCKETS; bucket++)
+	{
+		lows[bucket] = getStatsBucketLow(bucket);
+	}
+	lows[STATS_BUCKETS] = (long long)ONE << STATS_MAX_BITS;
+	for (bucket = 0; bucket < STATS_BUCKETS; bucket++)
+	{
+		if ((bucket < STATS_SUB_COUNT && lows[bucket] != bucket) ||
+			lows[bucket + ONE] <= lows[bucket] ||
+			(bucket >= STATS_SUB_COUNT && (lows[bucket + ONE] -
+			lows[bucket]) * STATS_SUB_COUNT > lows[bucket]))
+		{
+			printf("  bucket %d starts at %lld, the next at %lld\n", bucket,
+				lows[bucket], lows[bucket + ONE]);
+			return ONE;
+		}
+	}
+	return ZERO;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		recordSlice()
+//  Title:			Record slice
+//	Description:	This function will record samples [begin, end) as
+//					latencies of TEST_OP, from whichever thread runs it
+//	Input:			None
+//	Output:			None
+//	Calls:			recordStatsLatency()
+//	Parameters:		context	(void*) unused
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the stats test
+//----------------------------------------------------------------------------
+static void recordSlice(void* context, size_t begin, size_t end, int worker)
+{
+	size_t i = 0;
+	(void)context;
+	(void)worker;
+	for (i = begin; i < end; i++)
+	{
+		recordStatsLatency(TEST_OP, samples[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkHistogram()
+//  Title:			Check histogram
+//	Description:	This function will record every sample on TEST_THREADS
+//					threads and check the snapshot against the samples
+//					themselves: the calls, total and largest latency, every
+//					bucket's count from findBucket(), and every percentile
+//					against the sample of that rank in sorted order, which
+//					must be reported as the top of its bucket, or the
+//					largest latency when that is lower
+//	Input:			None
+//	Output:			the first values that differ
+//	Calls:			parallelFor()
+//					readStats()
+//					findBucket()
+//					qsort()
+//					getStatsBucketLow()
+//					getStatsPercentile()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the stats test
+//----------------------------------------------------------------------------
+static int checkHistogram(void)
+{
+	static StatsSnapshot snapshot;
+	static long long histogram[STATS_BUCKETS];
+	const OpStats* op = &snapshot.ops[TEST_OP];
+	long long total = 0;
+	long long rank = 0;
+	long long exact = 0;
+	long long expected = 0;
+	long long got = 0;
+	int failures = 0;
+	int bucket = 0;
+	int i = 0;
+
+	if (parallelFor(TEST_SAMPLES, TEST_GRAIN, TEST_THREADS, recordSlice,
+		NULL) != EXIT_SUCCESS)
+	{
+		recordSlice(NULL, 0, TEST_SAMPLES, 0);
+	}
+	readStats(&snapshot);
+	for (i = 0; i < TEST_SAMPLES; i++)
+	{
+		sorted[i] = samples[i] < ZERO ? ZERO : samples[i];
+		total += sorted[i];
+		histogram[findBucket(sorted[i])]++;
+	}
+	qsort(sorted, TEST_SAMPLES, sizeof(long long), compareNanos);
+	if (op->calls != TEST_SAMPLES || op->totalNanos != total ||
+		op->maxNanos != sorted[TEST_SAMPLES - ONE])
+	{
+		printf("  %lld calls, %lld ns, longest %lld\n", op->calls,
+			op->totalNanos, op->maxNanos);
+		failures++;
+	}
+	for (bucket = 0; bucket < STATS_BUCKETS; bucket++)
+	{
+		if (op->histogram[bucket] != histogram[bucket] &&
+			failures++ < MAX_REPORTS)
+		{
+			printf("  bucket %d holds %lld, not %lld\n", bucket,
+				op->histogram[bucket], histogram[bucket]);
+		}
+	}
+	for (i = 0; i < FRACTIONS; i++)
+	{
+		rank = (long long)(fractions[i] * TEST_SAMPLES + 0.5);
+		exact = sorted[(rank < ONE ? ONE : rank) - ONE];
+		bucket = findBucket(exact);
+		expected = bucket + ONE < STATS_BUCKETS ?
+			getStatsBucketLow(bucket + ONE) - ONE : op->maxNanos;
+		if (expected > op->maxNanos)
+		{
+			expected = op->maxNanos;
+		}
+		got = getStatsPercentile(op, fractions[i]);
+		if (got != expected || got < exact)
+		{
+			printf("  percentile %g is %lld, not %lld (sample %lld)\n",
+				fractions[i], got, expected, exact);
+			failures++;
+		}
+	}
+	return failures;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		checkRecording()
+//  Title:			Check recording
+//	Description:	This function will call getPaymentAmount() and check it
+//					was counted once per call when the library records
+//					statistics, and not at all when it does not
+//	Input:			None
+//	Output:			what went wrong
+//	Calls:			readStats()
+//					getPaymentAmount()
+//					isStatsEnabled()
+//	Parameters:		None
+//  Returns:		the number of failures
+//	History Log:	10/17/2026 written for the stats test
+//----------------------------------------------------------------------------
+static int checkRecording(void)
+{
+	static StatsSnapshot snapshot;
+	long long before = 0;
+	long long calls = 0;
+	int i = 0;
+
+	readStats(&snapshot);
+	before = snapshot.ops[STATS_PAYMENT].calls;
+	for (i = 0; i < TEST_PAYMENTS; i++)
+	{
+		getPaymentAmount(ONE + i % AMORT_MAX_MONTHS, 1000.0 + i, 0.005);
+	}
+	readStats(&snapshot);
+	calls = snapshot.ops[STATS_PAYMENT].calls - before;
+	if (calls != (isStatsEnabled() ? TEST_PAYMENTS : ZERO))
+	{
+		printf("  %d payments recorded as %lld calls\n", TEST_PAYMENTS,
+			calls);
+		return ONE;
+	}
+	return ZERO;
+}
+
+//----------------------------------------------------------------------------
+// Function:		main(int argc, char *argv[])
+//
+// Title:			Stats test
+//
+// Description:		Checks the latency histogram against the recorded
+//					latencies themselves: bucket edges, where each latency
+//					lands, the totals and the percentiles, recorded from
+//					several threads; then that the library's own calls are
+//					counted exactly when it is built with AMORT_STATS
+//
+// Output:			How many checks failed
+//
+//	Parameters:		argc	(int)
+//					argv	(char*[])
+//  Returns:		EXIT_SUCCESS when every check passes, or EXIT_FAILURE
+// Called By:		None
+// Calls:			initStats()
+//					checkEdges()
+//					makeSamples()
+//					checkHistogram()
+//					checkRecording()
+//
+// History Log:		10/17/2026: written for the latency statistics
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int failures = 0;
+
+	(void)argc;
+	(void)argv;
+	initStats();
+	failures += checkEdges();
+	if (failures == ZERO)
+	{
+		makeSamples();
+		failures += checkHistogram();
+	}
+	failures += checkRecording();
+	printf("  stats (%s): %d checks failed\n", isStatsEnabled() ?
+		"recording" : "not recording", failures);
+	return failures == ZERO ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,4 +1,6 @@
 #include "Amort.h"
+#include "AmortGrowth.h"
+#include "AmortStats.h"
 #include <stdio.h>
 #include <stdlib.h>
 #define ONE 1
@@ -8,10 +10,9 @@
 #define EIGHT 8
 #define HUNDRED 100
 #define HALF 0.5
-#define VERYSMALL 0.001
-#define MANYTIMES 20
+#define TOLERANCE 1e-12
+#define MAX_ITERATIONS 100
 #define YEARLY_INTEREST_RATE 1200
-#pragma once
 
 //----------------------------------------------------------------------------
 //	Function:		getPaymentAmount()
@@ -30,28 +31,39 @@
 //	Input:			None		
 //	Output:			None
 //	Calls:			roundToNextCent()
+//					getGrowthFactor()
+//					readStatsClock() and recordStatsLatency() with
+//					AMORT_STATS
 //	Parameters:		monthlyRate	(double)
 //					principal	(double)
 //					months	(int)
 //  Returns:		The amount of monthly payment 
 //					monthlyPayment	(double)
 //	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 growth factor from the lookup table
+//					10/17/2026 timed under AMORT_STATS
 //----------------------------------------------------------------------------
 double getPaymentAmount(int months, double principal, double monthlyRate)
 {
 	double numerator = 0.0;
 	double denominator = 0.0;
+	double growth = 0.0;
+	double payment = 0.0;
+	long long start = 0;
+	STATS_START(start);
 	if (monthlyRate == ZERO)
 	{
-		return roundToNextCent(principal / months);
+		payment = roundToNextCent(principal / months);
 	}
 	else
 	{
-		numerator = pow((ONE + monthlyRate), months) 
-			* principal * monthlyRate;
-		denominator = pow((ONE + monthlyRate), months) - ONE;
-		return roundToNextCent(numerator / denominator);
+		growth = getGrowthFactor(monthlyRate, months);
+		numerator = growth * principal * monthlyRate;
+		denominator = growth - ONE;
+		payment = roundToNextCent(numerator / denominator);
 	}
+	STATS_STOP(STATS_PAYMENT, start);
+	return payment;
 }
 
 //----------------------------------------------------------------------------
@@ -71,27 +83,39 @@ double getPaymentAmount(int months, double principal, double monthlyRate)
 //	Input:			None		
 //	Output:			None
 //	Calls:			roundToNearestCent()
+//					getGrowthFactor()
+//					readStatsClock() and recordStatsLatency() with
+//					AMORT_STATS
 //	Parameters:		totalPayment	(double)
 //					monthlyRate	(double)
 //					months	(int)
 //  Returns:		The amount of the entire loan	
 //					amountOfLoan	(double)
 //	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 growth factor from the lookup table
+//					10/17/2026 timed under AMORT_STATS
 //----------------------------------------------------------------------------
 double getLoanAmount(int months, double totalPayment, double monthlyRate)
 {
 	double numerator = 0.0;
 	double denominator = 0.0;
+	double growth = 0.0;
+	double amountOfLoan = 0.0;
+	long long start = 0;
+	STATS_START(start);
 	if (monthlyRate == ZERO)
 	{
-		return roundToNearestCent(totalPayment * months);
+		amountOfLoan = roundToNearestCent(totalPayment * months);
 	}
 	else
 	{
-		numerator = (pow((ONE + monthlyRate), months) - ONE) * totalPayment;
-		denominator = pow((ONE + monthlyRate), months) * monthlyRate;
-		return roundToNearestCent(numerator / denominator);
+		growth = getGrowthFactor(monthlyRate, months);
+		numerator = (growth - ONE) * totalPayment;
+		denominator = growth * monthlyRate;
+		amountOfLoan = roundToNearestCent(numerator / denominator);
 	}
+	STATS_STOP(STATS_LOAN, start);
+	return amountOfLoan;
 }
 
 //----------------------------------------------------------------------------
@@ -110,30 +134,37 @@ double getLoanAmount(int months, double totalPayment, double monthlyRate)
 //					Software: OS: MS Windows 10 Professional 64-bit
 //	Input:			None		
 //	Output:			None
-//	Calls:			None
+//	Calls:			readStatsClock() and recordStatsLatency() with
+//					AMORT_STATS
 //	Parameters:		monthlyRate	(double)
 //					principal	(double)
 //					totalPayment	(double)
 //  Returns:		The amount of months that payments need to be made	
 //					months	(int)
 //	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 timed under AMORT_STATS
 //----------------------------------------------------------------------------
 int getNumberOfMonths(double principal, double totalPayment,
 	double monthlyRate)
 {
 	double numerator = 0.0;
 	double denominator = 0.0;
+	int months = 0;
+	long long start = 0;
+	STATS_START(start);
 	if (monthlyRate == ZERO)
 	{
-		return (int)ceil(principal / totalPayment);
+		months = (int)ceil(principal / totalPayment);
 	}
 	else
 	{
 		numerator = log(totalPayment) - 
 			log(totalPayment - (principal*monthlyRate));
 		denominator = log(1 + monthlyRate);
-		return (int)ceil(numerator / denominator);
+		months = (int)ceil(numerator / denominator);
 	}
+	STATS_STOP(STATS_MONTHS, start);
+	return months;
 }
 
 //----------------------------------------------------------------------------
@@ -197,333 +228,135 @@ double getAppDer(double secondary, double primary, double distance)
 
 
 //----------------------------------------------------------------------------
-//	Function:		getInterestRate()
-//  Title:			Get interest rate
-//	Description:	This function will calculate the interest rate (APR) 
-//					for the program when size of loan, annual
-//					payment and number of months has been prompted
-//  Programmer:		Son Minh Tran
-//	Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit
-//	Input:			None		
+//	Function:		solveMonthlyRate()
+//  Title:			Solve monthly rate
+//	Description:	This function will find the monthly rate r at which
+//					monthlyPayment pays off sizeOfLoan in months payments,
+//					the root of r / (1 - (1 + r)^-months) = payment / loan.
+//					The left side grows with r, so the root stays inside
+//					[0, payment / loan]. Newton steps use the exact
+//					derivative and start from the tangent of the left side
+//					at r = 0 (or payment / loan when that is closer), which
+//					lands above the root where the convex curve makes
+//					Newton fall straight onto it; a step that
+//					would leave the bracket is replaced by bisection, so
+//					the loop always converges and stops once the step is
+//					below TOLERANCE instead of after a fixed count
+//	Input:			None
 //	Output:			None
-//	Calls:			getAppDer()
-//					iterativeFormula()
-//					roundToOneEighth()
-//	Parameters:		sizeOfLoan	(double)
+//	Calls:			addStatsCount() with AMORT_STATS
+//	Parameters:		sizeOfLoan		(double)
 //					monthlyPayment	(double)
-//					months	(int)
-//  Returns:		The interest rate for the program	
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-double getInterestRate(double sizeOfLoan, double monthlyPayment, int months)
+//					months			(int)
+//					iterations		(int*) evaluations used, may be NULL
+//  Returns:		the monthly rate, 0 when the payments do not even
+//					cover the loan
+//	History Log:	10/17/2026 written for the analytic APR solver
+//					10/17/2026 steps and failures counted under AMORT_STATS
+//----------------------------------------------------------------------------
+double solveMonthlyRate(double sizeOfLoan, double monthlyPayment, int months,
+	int * iterations)
 {
-	double rateGuess = 0.0;
+	double target = 0.0;
+	double low = 0.0;
+	double high = 0.0;
+	double rate = 0.0;
+	double next = 0.0;
+	double paidOff = 0.0;
+	double value = 0.0;
+	double slope = 0.0;
 	int counter = 0;
+
 	if (monthlyPayment * months <= sizeOfLoan)
 	{
+		if (iterations != NULL)
+		{
+			*iterations = 0;
+		}
 		return 0;
 	}
-	//apply newton-raphson method
-	rateGuess = ((monthlyPayment * months) - sizeOfLoan) / (sizeOfLoan);
-	int keepGoing = TRUE;
-	while (keepGoing == TRUE)
+	target = monthlyPayment / sizeOfLoan;
+	high = target;
+	rate = (target - (double)ONE / months) * 2 * months / (months + ONE);
+	if (rate >= high)
 	{
-		rateGuess = rateGuess - (iterativeFormula(sizeOfLoan, monthlyPayment,
-			rateGuess, months) / 
-			(getAppDer(iterativeFormula(sizeOfLoan,
-				monthlyPayment, rateGuess + VERYSMALL, months),
-				iterativeFormula
-				(sizeOfLoan, monthlyPayment, rateGuess, months), VERYSMALL)));
-		counter++;
-		if (counter == MANYTIMES)
-		{
-			keepGoing = FALSE;
-		}
+		//payment / loan is above the root as well
+		rate = high;
 	}
-	rateGuess = rateGuess * YEARLY_INTEREST_RATE;
-	return roundToOneEighth(rateGuess);
-}
-
-//----------------------------------------------------------------------------
-//	Function:		readApr()
-//  Title:			read APR
-//	Description:	This function will read in the annual percentage rate
-//					from the console where user enter the apr
-//  Programmer:		Son Minh Tran
-//	Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit
-//	Input:			user input the apr		
-//	Output:			roudn to one eight and print out apr
-//	Calls:			safeReadDouble()
-//					roundToOneEighth()
-//	Parameters:		void
-//  Returns:		the APR	
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-double readApr() {
-	double interestRate = 0.0;
-	printf("\nEnter the interest rate (APR) you will be paying"
-		"(nearest 1/8 points, >=0): ");
-	int condition = FALSE;
-	do
+	for (counter = 1; counter <= MAX_ITERATIONS; counter++)
 	{
-		safeReadDouble(&interestRate, "Please enter a non-negative number");
-		if (interestRate < 0)
+		//paidOff is 1 - (1 + rate)^-months without the cancellation
+		paidOff = -expm1(-months * log1p(rate));
+		value = rate / paidOff - target;
+		if (value > 0)
 		{
-			printf("please enter a positive value for Annual Payment Rate: ");
-			condition = TRUE;
-		}
-		else {
-			interestRate = roundToOneEighth(interestRate);
-			printf("Interest: %.3lf%c", interestRate, '%');
-			condition = FALSE;
+			high = rate;
 		}
-	} while (condition == TRUE);
-	return interestRate;
-}
-
-//----------------------------------------------------------------------------
-//	Function:		readPrincipal()
-//  Title:			read Principal
-//	Description:	This function will read in the total loan 
-//					from the console where user enter the total loan
-//  Programmer:		Son Minh Tran
-//	Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit
-//	Input:			user input the principal		
-//	Output:			roudn to nearest cent and print out the console
-//	Calls:			safeReadDouble()
-//					roundToNearestCent()
-//	Parameters:		void
-//  Returns:		the principal
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-double readPrincipal() {
-	double loan = 0.0;
-	printf("\nEnter the amount of money to be borrowed (amount > 0): $");
-	int condition = FALSE;
-	do
-	{
-		safeReadDouble(&loan, "\nPlease enter a non-negative number");
-		if (loan <= 0)
+		else
 		{
-			printf("\nThe amount of Loan needs to be bigger than 0");
-			condition = TRUE;
+			low = rate;
 		}
-		else {
-			printf("Principal: $%.2lf", loan);
-			condition = FALSE;
-		}
-	} while (condition == TRUE);
-	return roundToNearestCent(loan);
-}
-
-//----------------------------------------------------------------------------
-//	Function:		readMonth()
-//  Title:			read Principal
-//	Description:	This function will read in the number of month 
-//					from the console where user enter the number of months
-//	Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit
-//	Input:			user input the month	
-//	Output:			print out the month
-//	Calls:			safeReadInt()
-//	Parameters:		void
-//  Returns:		the numbers of month
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-int readMonth() {
-	int numMonth = 0;
-	int condition = FALSE;
-	printf("\nEnter the number of months you will be making "
-		"payments (0 < months <= 360): ");
-	do
-	{
-		safeReadInt(&numMonth, "\nPlease enter a non - negative"
-			"number from 0 to 360:");
-		if (numMonth <= 0 || numMonth > 360)
+		slope = (paidOff - months * rate * (ONE - paidOff) / (ONE + rate))
+			/ (paidOff * paidOff);
+		next = rate - value / slope;
+		if (fabs(next - rate) <= TOLERANCE * rate)
 		{
-			puts("\nYou have to input positive number for number of months");
-			condition = TRUE;
-		}
-		else {
-			printf("Number of Months to pay: %d", numMonth);
-			condition = FALSE;
+			rate = next;
+			break;
 		}
-	} while (condition == TRUE);
-	return numMonth;
-}
-
-//----------------------------------------------------------------------------
-//	Function:		readPayment()
-//  Title:			read Payment
-//	Description:	This function will read in amount of monthly payment
-//					from the console where user enter the monthly payment
-//	Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit
-//	Input:			user input the amount of monthly payment	
-//	Output:			roudn to nearest cent and print out the monthly payment
-//	Calls:			safeReadDouble()
-//					roundToNearestCent()
-//	Parameters:		void
-//  Returns:		the amount of monthly payment
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-double readPayment() {
-	double payment = 0.0;
-	int condition = FALSE;
-	printf("\nEnter the amount of the monthly payment (amount > 0): $");
-	do
-	{
-		safeReadDouble(&payment, "\nPlease enter a non-negative number");
-		if (payment <= 0)
+		if (!(next > low && next < high))
 		{
-			puts("\nPlease enter number bigger" 
-				"than 0 for your monthly payment");
-			condition = TRUE;
+			next = (low + high) * HALF;
 		}
-		else {
-			printf("Payment: $%.2lf per month", payment);
-			condition = FALSE;
-		}
-	} while (condition == TRUE);
-	return roundToNearestCent(payment);
-}
-
-//----------------------------------------------------------------------------
-//	Function:		safeReadDouble()
-//  Title:			Read in safe double value
-//	Description:	This function will read in the right (double) input number 
-//					into the program
-//  Programmer:		Son Minh Tran
-//  Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit 
-//	Input:			read in a number
-//					number_ptr (double*)
-//	Output:			a prompt if a invalid number has been entered
-//	Calls:			cleanBuffer()
-//	Parameters:		number_ptr (int*)
-//					prompt (const char*)
-//  Returns:		None
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-void safeReadDouble(double * number_ptr, const char * prompt)
-{
-	while ((scanf("%lf", number_ptr)) != ONE)
-	{
-		puts(prompt);
-		cleanBuffer();
+		rate = next;
 	}
-	cleanBuffer();
-}
-
-//----------------------------------------------------------------------------
-//	Function:		safeReadInt()
-//  Title:			Read in safe integer value
-//	Description:	This function will read in the right (integer) input  
-//					number into the program
-//  Programmer:		Son Minh Tran
-//  Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit 
-//	Input:			read in a number
-//					number_ptr (double*)
-//	Output:			a prompt if a invalid number has been entered
-//	Calls:			cleanBuffer()
-//	Parameters:		number_ptr (int*)
-//					prompt (const char*)
-//  Returns:		None
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-void safeReadInt(int * number_ptr, const char * prompt)
-{
-	while ((scanf("%d", number_ptr)) != ONE)
+	STATS_COUNT(STATS_NEWTON_STEPS,
+		counter > MAX_ITERATIONS ? MAX_ITERATIONS : counter);
+	STATS_COUNT(STATS_NEWTON_FAILURES, counter > MAX_ITERATIONS);
+	if (iterations != NULL)
 	{
-		puts(prompt);
-		cleanBuffer();
+		*iterations = counter > MAX_ITERATIONS ? MAX_ITERATIONS : counter;
 	}
-	cleanBuffer();
+	return rate;
 }
 
 //----------------------------------------------------------------------------
-//	Function:		cleanBuffer()
-//  Title:			Clean the buffer
-//	Description:	This function will clean the buffer for the program
+//	Function:		getInterestRate()
+//  Title:			Get interest rate
+//	Description:	This function will calculate the interest rate (APR) 
+//					for the program when size of loan, annual
+//					payment and number of months has been prompted
 //  Programmer:		Son Minh Tran
-//  Date:			03/04/2017
+//	Date:			03/04/2017
 //	Version:			1.0
 //	Environment:		HP Elitebook 8570P 
 //					Hardware: 8GB
 //							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit 
+//					Software: OS: MS Windows 10 Professional 64-bit
 //	Input:			None		
 //	Output:			None
-//	Calls:			None
-//	Parameters:		None
-//  Returns:		None
+//	Calls:			solveMonthlyRate()
+//					roundToOneEighth()
+//					readStatsClock() and recordStatsLatency() with
+//					AMORT_STATS
+//	Parameters:		sizeOfLoan	(double)
+//					monthlyPayment	(double)
+//					months	(int)
+//  Returns:		The interest rate for the program	
 //	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 converged solver replaces the 20 fixed
+//					finite-difference Newton steps
+//					10/17/2026 timed under AMORT_STATS
 //----------------------------------------------------------------------------
-void cleanBuffer()
+double getInterestRate(double sizeOfLoan, double monthlyPayment, int months)
 {
-	while (getchar() != '\n');
-}
-
-//----------------------------------------------------------------------------
-//	Function:		printMenu()
-//  Title:			print menu
-//	Description:	This function will print out the menu option
-//  Programmer:		Son Minh Tran
-//  Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit 
-//	Input:			None		
-//	Output:			None
-//	Calls:			None
-//	Parameters:		None
-//  Returns:		None
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-void printMenu() {
-	printf("Amortization!\n");
-	printf("Amortization Program written by Son Tran. ");
-	printf("Please select a Menu Option\n\n");
-	printf("\t1. Calculate (P)ayment Size\n");
-	printf("\t2. Calculate (L)oan Size\n");
-	printf("\t3. Calculate (N)umber of Payments\n");
-	printf("\t4. Calculate (I)nterest (APR)\n");
-	printf("\t5. (Q)uit\n\n");
-	printf("Enter a menu option: ");
+	double rate = 0.0;
+	long long start = 0;
+	STATS_START(start);
+	rate = solveMonthlyRate(sizeOfLoan, monthlyPayment, months, NULL);
+	rate = roundToOneEighth(rate * YEARLY_INTEREST_RATE);
+	STATS_STOP(STATS_RATE, start);
+	return rate;
 }
 
 //----------------------------------------------------------------------------
@@ -600,122 +433,3 @@ double roundToOneEighth(double number) {
 double roundToNearestCent(double number) {
 	return floor(number * HUNDRED + HALF) / HUNDRED;
 }
-
-//----------------------------------------------------------------------------
-//	Function:		printTable()
-//  Title:			print table
-//	Description:	This function will print the table out to a file
-//  Programmer:		Son Minh Tran
-//  Date:			03/04/2017
-//	Version:			1.0
-//	Environment:		HP Elitebook 8570P 
-//					Hardware: 8GB
-//							  Intel(R) Core(TM) i5-3320M 
-//					Software: OS: MS Windows 10 Professional 64-bit 
-//	Input:			None		
-//	Output:			print and export a file contain the table of APR, payment
-//	Calls:			roundToNextCent
-//	Parameters:		principal	(double)
-//					payment		(double)
-//					monthlyRate	(double)
-//					month		(int)
-//  Returns:		void
-//	History Log:	03/04/2017 Complete version 1.0
-//----------------------------------------------------------------------------
-void printTable(double principal, double payment, double monthlyRate, int month) {
-	char ch = ' ';
-	char filename[FILENAME_MAX] = "AmTable.txt";
-	int returnValue = EXIT_SUCCESS;
-	double interestPaid = 0.0;
-	double principalPaid = 0.0;
-	double loanBalance = 0.0;
-	double tabPayment = 0.0;
-	int countMonth = 1;
-	FILE * outFileHandle = NULL;
-	int i = 0;
-	printf("\nDo you wish to print an Amortization Table(Y/N)? Y\b");
-	ch = getche();
-	if (ch == 'N' || ch == 'n')
-	{
-		return;
-	}
-	else {
-		outFileHandle = fopen(filename, "w");
-		loanBalance = principal;
-		if (outFileHandle == NULL)
-		{
-			printf("Could not open file %s for output.\n"
-				"Press any key to Continue", filename);
-			returnValue = EXIT_FAILURE;
-		}
-		else {
-			fprintf(outFileHandle, "Amortization Table for $%.2lf Loan "
-				"at %.3lf%% interest for %d months\n", principal,
-				monthlyRate * 1200, month);
-			fprintf(outFileHandle, "\n");
-			fprintf(outFileHandle, "%s %22s %15s %15s\n",
-				"Payments", "Principal Paid", "Interest Paid",
-				"Loan Balance");
-			if (monthlyRate == 0)
-			{
-				tabPayment = payment;
-				interestPaid = 0;
-				principalPaid = payment;
-				for (i = 0; i < month; i++)
-				{
-					if (i < month - 1)
-					{
-						loanBalance -= principalPaid;
-					}
-					else
-					{
-						principalPaid = loanBalance;
-						tabPayment = loanBalance;
-						loanBalance = 0;
-					}
-					fprintf(outFileHandle, "%-5d ( %8.2lf) ",
-						countMonth, tabPayment);
-					fprintf(outFileHandle, "$ %13.2lf ",
-						principalPaid);
-					fprintf(outFileHandle, "$ %13.2lf ",
-						interestPaid);
-					fprintf(outFileHandle, "$ %12.2lf \n",
-						loanBalance);
-					countMonth++;
-				}
-			}
-			else
-			{
-				for (i = month; i > ZERO; i--)
-				{
-					if (i > ONE)
-					{
-						tabPayment = getPaymentAmount(i, loanBalance, monthlyRate);
-						interestPaid = loanBalance * monthlyRate;
-						principalPaid = tabPayment - interestPaid;
-						loanBalance -= principalPaid;
-					}
-					else
-					{
-						interestPaid = loanBalance * monthlyRate;
-						principalPaid = loanBalance;
-						tabPayment = roundToNextCent(principalPaid + interestPaid);
-						loanBalance = 0;
-					}
-
-					fprintf(outFileHandle, "%-5d ( %8.2lf) ",
-						countMonth, tabPayment);
-					fprintf(outFileHandle, "$ %13.2lf ",
-						principalPaid);
-					fprintf(outFileHandle, "$ %13.2lf ",
-						interestPaid);
-					fprintf(outFileHandle, "$ %12.2lf \n",
-						loanBalance);
-					countMonth++;
-				}
-			}
-		}
-		fclose(outFileHandle);
-		system("AmTable.txt");
-	}
-}
@@ -0,0 +1,212 @@
+#include "AmortApi.h"
+#include "AmortCents.h"
+#define ONE 1
+#define ZERO 0
+#define MONTHPERCENT 1200
+
+//----------------------------------------------------------------------------
+//	Function:		amortCalculate()
+//  Title:			Amortization calculate
+//	Description:	This function will do for one request what main() does
+//					for one menu option: round the inputs the way the read
+//					functions do, check them against the same limits and
+//					calculate the missing value. It keeps no state, takes no
+//					lock, allocates nothing and does no I/O, so any number
+//					of threads can call it at once once initGrowthTable()
+//					has run. The payment follows the request's arithmetic,
+//					which the result keeps for the loan's table
+//	Input:			None
+//	Output:			None
+//	Calls:			roundToOneEighth()
+//					roundToNearestCent()
+//					getSchedulePayment()
+//					getLoanAmount()
+//					getNumberOfMonths()
+//					getInterestRate()
+//	Parameters:		request	(const AmortRequest*)
+//					result	(AmortResult*)
+//  Returns:		AMORT_OK, or the AMORT_ status of the broken rule, which
+//					is also left in result->status
+//	History Log:	10/17/2026 written for the reentrant calculation API
+//					10/17/2026 payment from getSchedulePayment()
+//					10/17/2026 arithmetic taken from the request
+//					10/17/2026 infinite inputs and answers refused
+//----------------------------------------------------------------------------
+int amortCalculate(const AmortRequest* request, AmortResult* result)
+{
+	int needApr = request->mode != 'I';
+	int needPrincipal = request->mode != 'L';
+	int needPayment = request->mode != 'P';
+	int needMonths = request->mode != 'N';
+
+	result->apr = needApr ? roundToOneEighth(request->apr) : 0.0;
+	result->principal = needPrincipal ?
+		roundToNearestCent(request->principal) : 0.0;
+	result->payment = needPayment ? roundToNearestCent(request->payment) : 0.0;
+	result->months = needMonths ? request->months : 0;
+	result->monthlyRate = result->apr / MONTHPERCENT;
+	result->arithmetic = request->arithmetic == ARITHMETIC_CENTS ?
+		ARITHMETIC_CENTS : ARITHMETIC_DOUBLE;
+	if (request->mode != 'P' && request->mode != 'L' &&
+		request->mode != 'N' && request->mode != 'I')
+	{
+		result->status = AMORT_BAD_MODE;
+	}
+	else if (needApr && !(request->apr >= 0 && isfinite(request->apr)))
+	{
+		result->status = AMORT_BAD_APR;
+	}
+	else if (needPrincipal &&
+		!(request->principal > 0 && isfinite(request->principal)))
+	{
+		result->status = AMORT_BAD_PRINCIPAL;
+	}
+	else if (needPayment &&
+		!(request->payment > 0 && isfinite(request->payment)))
+	{
+		result->status = AMORT_BAD_PAYMENT;
+	}
+	else if (needMonths &&
+		(request->months <= ZERO || request->months > AMORT_MAX_MONTHS))
+	{
+		result->status = AMORT_BAD_MONTHS;
+	}
+	else
+	{
+		result->status = AMORT_OK;
+	}
+	if (result->status != AMORT_OK)
+	{
+		return result->status;
+	}
+	switch (request->mode)
+	{
+		case 'P':
+			result->payment = getSchedulePayment(result->months,
+				result->principal, result->monthlyRate, result->arithmetic);
+			break;
+		case 'L':
+			result->principal = getLoanAmount(result->months,
+				result->payment, result->monthlyRate);
+			break;
+		case 'N':
+			//same bounds main() asks the user to respect
+			if (result->payment <= roundToNearestCent(result->principal *
+				result->monthlyRate))
+			{
+				result->status = AMORT_PAYMENT_TOO_SMALL;
+			}
+			else if (result->payment > roundToNearestCent(result->principal *
+				(ONE + result->monthlyRate)))
+			{
+				result->status = AMORT_PAYMENT_TOO_LARGE;
+			}
+			else
+			{
+				result->months = getNumberOfMonths(result->principal,
+					result->payment, result->monthlyRate);
+			}
+			break;
+		default:
+			if (result->months < ceil(result->principal / result->payment))
+			{
+				result->status = AMORT_TERM_TOO_SHORT;
+			}
+			else
+			{
+				result->apr = getInterestRate(result->principal,
+					result->payment, result->months);
+				result->monthlyRate = result->apr / MONTHPERCENT;
+			}
+			break;
+	}
+	//finite inputs can still be too large for a finite answer
+	if (result->status == AMORT_OK && !(isfinite(result->payment) &&
+		isfinite(result->principal) && isfinite(result->apr)))
+	{
+		result->status = AMORT_TOO_LARGE;
+	}
+	return result->status;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		amortSchedule()
+//  Title:			Amortization schedule
+//	Description:	This function will fill the caller's rows with the
+//					amortization table of a loan amortCalculate() finished,
+//					the double table printTable() writes, without allocating
+//					or writing anything else. A loan in ARITHMETIC_CENTS
+//					prints the generateScheduleCents() table instead
+//	Input:			None
+//	Output:			None
+//	Calls:			generateSchedule()
+//	Parameters:		loan		(const AmortResult*)
+//					rows		(ScheduleRow*)
+//					capacity	(int) rows the caller has room for
+//					count		(int*) rows filled
+//  Returns:		AMORT_OK, the loan's own status when it failed, or
+//					AMORT_NO_ROOM when capacity is below its months
+//	History Log:	10/17/2026 written for the reentrant calculation API
+//----------------------------------------------------------------------------
+int amortSchedule(const AmortResult* loan, ScheduleRow* rows, int capacity,
+	int* count)
+{
+	*count = 0;
+	if (loan->status != AMORT_OK)
+	{
+		return loan->status;
+	}
+	if (capacity < loan->months)
+	{
+		return AMORT_NO_ROOM;
+	}
+	*count = generateSchedule(loan->principal, loan->payment,
+		loan->monthlyRate, loan->months, rows);
+	return AMORT_OK;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		amortStatusText()
+//  Title:			Amortization status text
+//	Description:	This function will describe an AMORT_ status
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		status	(int)
+//  Returns:		a constant string
+//	History Log:	10/17/2026 written for the reentrant calculation API
+//					10/17/2026 AMORT_BAD_FORMAT
+//					10/17/2026 AMORT_TOO_LARGE
+//----------------------------------------------------------------------------
+const char* amortStatusText(int status)
+{
+	switch (status)
+	{
+		case AMORT_OK:
+			return "ok";
+		case AMORT_BAD_MODE:
+			return "mode is not P, L, N or I";
+		case AMORT_BAD_APR:
+			return "APR is negative or not finite";
+		case AMORT_BAD_PRINCIPAL:
+			return "principal is not a finite amount above 0";
+		case AMORT_BAD_PAYMENT:
+			return "payment is not a finite amount above 0";
+		case AMORT_BAD_MONTHS:
+			return "months is not from 1 to 360";
+		case AMORT_PAYMENT_TOO_SMALL:
+			return "payment does not cover the interest";
+		case AMORT_PAYMENT_TOO_LARGE:
+			return "payment is more than the loan and its interest";
+		case AMORT_TERM_TOO_SHORT:
+			return "months are too few to repay the principal";
+		case AMORT_NO_ROOM:
+			return "not enough rows for the schedule";
+		case AMORT_BAD_FORMAT:
+			return "not \"mode,apr,principal,payment,months\"";
+		case AMORT_TOO_LARGE:
+			return "the answer is too large to calculate";
+		default:
+			return "unknown status";
+	}
+}
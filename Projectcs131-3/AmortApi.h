@@ -0,0 +1,56 @@
+#ifndef AMORTAPI_H
+#define AMORTAPI_H
+#include "Amort.h"
+#include "AmortSchedule.h"
+#include "AmortCents.h"
+#define AMORT_OK 0
+#define AMORT_BAD_MODE 1
+#define AMORT_BAD_APR 2
+#define AMORT_BAD_PRINCIPAL 3
+#define AMORT_BAD_PAYMENT 4
+#define AMORT_BAD_MONTHS 5
+#define AMORT_PAYMENT_TOO_SMALL 6
+#define AMORT_PAYMENT_TOO_LARGE 7
+#define AMORT_TERM_TOO_SHORT 8
+#define AMORT_NO_ROOM 9
+#define AMORT_BAD_FORMAT 10
+#define AMORT_TOO_LARGE 11
+#define AMORT_MAX_MONTHS 360
+//----------------------------------------------------------------------------
+// AmortRequest: a loan with one value missing
+//		mode		'P' payment, 'L' loan size, 'N' number of months,
+//					'I' interest rate (same letters as the menu)
+//		apr, principal, payment, months as typed by the user; the field
+//		the mode calculates is ignored
+//		arithmetic	ARITHMETIC_DOUBLE or ARITHMETIC_CENTS, how the payment
+//					and the loan's table are worked out
+//----------------------------------------------------------------------------
+typedef struct AmortRequest {
+	char mode;
+	double apr;
+	double principal;
+	double payment;
+	int months;
+	int arithmetic;
+} AmortRequest;
+//----------------------------------------------------------------------------
+// AmortResult: the whole loan once the missing value is calculated
+//		status		AMORT_OK or the first rule the request broke
+//		the inputs are rounded the way the console rounds them
+//		arithmetic	the request's, so the table of the loan is the one its
+//					payment was worked out for
+//----------------------------------------------------------------------------
+typedef struct AmortResult {
+	int status;
+	double apr;
+	double monthlyRate;
+	double principal;
+	double payment;
+	int months;
+	int arithmetic;
+} AmortResult;
+int amortCalculate(const AmortRequest* request, AmortResult* result);
+int amortSchedule(const AmortResult* loan, ScheduleRow* rows, int capacity,
+	int* count);
+const char* amortStatusText(int status);
+#endif
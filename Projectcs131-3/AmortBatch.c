@@ -0,0 +1,272 @@
+#include "AmortBatch.h"
+#include "AmortParallel.h"
+#include "AmortApi.h"
+#include "AmortReader.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define IO_BUFFER_SIZE (1 << 20)
+
+//----------------------------------------------------------------------------
+//	Function:		priceLoan()
+//  Title:			Price loan
+//	Description:	This function will do for one record what main() does
+//					for one menu option: round the inputs the way the read
+//					functions do, check them against the same limits and
+//					calculate the missing value
+//	Input:			None
+//	Output:			None
+//	Calls:			amortCalculate()
+//	Parameters:		record	(const LoanRecord*)
+//					result	(LoanResult*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the batch file mode
+//					10/17/2026 calculation moved to amortCalculate()
+//----------------------------------------------------------------------------
+void priceLoan(const LoanRecord* record, LoanResult* result)
+{
+	AmortRequest request;
+	AmortResult loan;
+	request.mode = record->mode;
+	request.apr = record->apr;
+	request.principal = record->principal;
+	request.payment = record->payment;
+	request.months = record->months;
+	request.arithmetic = ARITHMETIC_DOUBLE;
+	result->status = amortCalculate(&request, &loan) == AMORT_OK ?
+		BATCH_OK : BATCH_INVALID;
+	result->apr = loan.apr;
+	result->principal = loan.principal;
+	result->payment = loan.payment;
+	result->months = loan.months;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		priceLoanBatch()
+//  Title:			Price loan batch
+//	Description:	This function will price every record of an array,
+//					result i belongs to record i
+//	Input:			None
+//	Output:			None
+//	Calls:			priceLoan()
+//	Parameters:		records	(const LoanRecord*)
+//					results	(LoanResult*)
+//					count	(size_t)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the batch file mode
+//----------------------------------------------------------------------------
+void priceLoanBatch(const LoanRecord* records, LoanResult* results,
+	size_t count)
+{
+	size_t i = 0;
+	for (i = 0; i < count; i++)
+	{
+		priceLoan(&records[i], &results[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+// BatchSlice: the arrays priceLoanBatchParallel() hands to its workers
+//----------------------------------------------------------------------------
+typedef struct BatchSlice {
+	const LoanRecord* records;
+	LoanResult* results;
+} BatchSlice;
+
+//----------------------------------------------------------------------------
+//	Function:		priceBatchSlice()
+//  Title:			Price batch slice
+//	Description:	This function will price records [begin, end) for one
+//					worker of priceLoanBatchParallel()
+//	Input:			None
+//	Output:			None
+//	Calls:			priceLoanBatch()
+//	Parameters:		context	(void*)
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+static void priceBatchSlice(void* context, size_t begin, size_t end,
+	int worker)
+{
+	BatchSlice* slice = (BatchSlice*)context;
+	(void)worker;
+	priceLoanBatch(slice->records + begin, slice->results + begin,
+		end - begin);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		priceLoanBatchParallel()
+//  Title:			Price loan batch in parallel
+//	Description:	This function will price every record of an array on
+//					threadCount threads (0 for every processor). Results
+//					land at the index of their record, so the output order
+//					does not depend on which thread priced what
+//	Input:			None
+//	Output:			None
+//	Calls:			parallelFor()
+//					priceBatchSlice()
+//	Parameters:		records		(const LoanRecord*)
+//					results		(LoanResult*)
+//					count		(size_t)
+//					threadCount	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+void priceLoanBatchParallel(const LoanRecord* records, LoanResult* results,
+	size_t count, int threadCount)
+{
+	BatchSlice slice;
+	slice.records = records;
+	slice.results = results;
+	if (parallelFor(count, BATCH_GRAIN, threadCount, priceBatchSlice,
+		&slice) != EXIT_SUCCESS)
+	{
+		priceLoanBatch(records, results, count);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		formatLoanResult()
+//  Title:			Format loan result
+//	Description:	This function will write a result as one output line
+//					"mode,apr,principal,payment,months" with the same
+//					precision the console prints, or "mode,ERROR"
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		mode	(char)
+//					result	(const LoanResult*)
+//					buffer	(char*)
+//					size	(size_t)
+//  Returns:		number of characters written, as snprintf()
+//	History Log:	10/17/2026 written for the batch file mode
+//----------------------------------------------------------------------------
+int formatLoanResult(char mode, const LoanResult* result, char* buffer,
+	size_t size)
+{
+	if (result->status != BATCH_OK)
+	{
+		return snprintf(buffer, size, "%c,ERROR\n", mode);
+	}
+	return snprintf(buffer, size, "%c,%.3lf,%.2lf,%.2lf,%d\n", mode,
+		result->apr, result->principal, result->payment, result->months);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runBatchFile()
+//  Title:			Run batch file
+//	Description:	This function will stream a batch file through the
+//					calculations BATCH_CHUNK records at a time and write one
+//					output line per record. Blank lines and lines starting
+//					with '#' are skipped, bad lines are reported with their
+//					line number and written as errors. Each chunk is priced
+//					on threadCount threads (0 for every processor)
+//	Input:			the batch file
+//	Output:			the result file, errors to stderr
+//	Calls:			openLoanReader()
+//					readLoanLine()
+//					getLoanRequest()
+//					amortStatusText()
+//					priceLoanBatchParallel()
+//					formatLoanResult()
+//					closeLoanReader()
+//	Parameters:		inName		(const char*)
+//					outName		(const char*)
+//					threadCount	(int)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when a file cannot be used
+//	History Log:	10/17/2026 written for the batch file mode
+//					10/17/2026 lines parsed in place by the mapped
+//					LoanReader, which also names the broken rule
+//----------------------------------------------------------------------------
+int runBatchFile(const char* inName, const char* outName, int threadCount)
+{
+	char text[BATCH_LINE_MAX];
+	LoanReader reader;
+	LoanLine line;
+	AmortRequest request;
+	FILE * outFileHandle = NULL;
+	LoanRecord * records = NULL;
+	LoanResult * results = NULL;
+	int * parsed = NULL;
+	size_t count = 0;
+	size_t i = 0;
+	long invalid = 0;
+	int returnValue = EXIT_SUCCESS;
+	int opened = EXIT_FAILURE;
+	int endOfFile = 0;
+
+	opened = openLoanReader(&reader, inName);
+	outFileHandle = fopen(outName, "w");
+	records = malloc(BATCH_CHUNK * sizeof(LoanRecord));
+	results = malloc(BATCH_CHUNK * sizeof(LoanResult));
+	parsed = malloc(BATCH_CHUNK * sizeof(int));
+	if (opened != EXIT_SUCCESS || outFileHandle == NULL || records == NULL ||
+		results == NULL || parsed == NULL)
+	{
+		fprintf(stderr, "Could not open %s or %s\n", inName, outName);
+		returnValue = EXIT_FAILURE;
+	}
+	else
+	{
+		setvbuf(outFileHandle, NULL, _IOFBF, IO_BUFFER_SIZE);
+		while (!endOfFile)
+		{
+			//fill one chunk
+			count = 0;
+			while (count < BATCH_CHUNK)
+			{
+				if (!readLoanLine(&reader, &line))
+				{
+					endOfFile = 1;
+					break;
+				}
+				getLoanRequest(&line, &request);
+				records[count].mode = request.mode;
+				records[count].apr = request.apr;
+				records[count].principal = request.principal;
+				records[count].payment = request.payment;
+				records[count].months = request.months;
+				parsed[count] = line.status == AMORT_OK ? BATCH_OK :
+					BATCH_INVALID;
+				if (line.status != AMORT_OK)
+				{
+					fprintf(stderr, "line %ld: %s\n", line.lineNumber,
+						amortStatusText(line.status));
+				}
+				count++;
+			}
+			priceLoanBatchParallel(records, results, count, threadCount);
+			for (i = 0; i < count; i++)
+			{
+				if (parsed[i] != BATCH_OK)
+				{
+					results[i].status = BATCH_INVALID;
+				}
+				if (results[i].status != BATCH_OK)
+				{
+					invalid++;
+				}
+				formatLoanResult(records[i].mode, &results[i], text,
+					sizeof(text));
+				fputs(text, outFileHandle);
+			}
+		}
+		if (invalid > 0)
+		{
+			fprintf(stderr, "%ld record(s) could not be calculated\n",
+				invalid);
+		}
+	}
+	closeLoanReader(&reader);
+	if (outFileHandle != NULL)
+	{
+		fclose(outFileHandle);
+	}
+	free(records);
+	free(results);
+	free(parsed);
+	return returnValue;
+}
@@ -0,0 +1,45 @@
+#ifndef AMORTBATCH_H
+#define AMORTBATCH_H
+#include <stddef.h>
+#include "Amort.h"
+#define BATCH_OK 0
+#define BATCH_INVALID 1
+#define BATCH_CHUNK 65536
+#define BATCH_GRAIN 256
+#define BATCH_LINE_MAX 256
+//----------------------------------------------------------------------------
+// LoanRecord: one line of a batch file
+//		mode		'P' payment, 'L' loan size, 'N' number of months,
+//					'I' interest rate (same letters as the menu)
+//		apr, principal, payment, months as parseLoanLine() read them;
+//		the fields the mode does not need are ignored
+//----------------------------------------------------------------------------
+typedef struct LoanRecord {
+	char mode;
+	double apr;
+	double principal;
+	double payment;
+	int months;
+} LoanRecord;
+//----------------------------------------------------------------------------
+// LoanResult: the loan after the missing value has been calculated
+//		status		BATCH_OK or BATCH_INVALID when the record breaks the
+//					same rules readApr(), readPrincipal(), readPayment()
+//					and readMonth() enforce on the console
+//----------------------------------------------------------------------------
+typedef struct LoanResult {
+	int status;
+	double apr;
+	double principal;
+	double payment;
+	int months;
+} LoanResult;
+void priceLoan(const LoanRecord* record, LoanResult* result);
+void priceLoanBatch(const LoanRecord* records, LoanResult* results,
+	size_t count);
+void priceLoanBatchParallel(const LoanRecord* records, LoanResult* results,
+	size_t count, int threadCount);
+int formatLoanResult(char mode, const LoanResult* result, char* buffer,
+	size_t size);
+int runBatchFile(const char* inName, const char* outName, int threadCount);
+#endif
@@ -0,0 +1,412 @@
+#include "AmortBinary.h"
+#include "AmortReader.h"
+#include <string.h>
+#define ONE 1
+#define ZERO 0
+#define HALF 0.5
+#define HUNDRED 100
+#define THOUSAND 1000
+#define YEARLY_INTEREST_RATE 1200
+#define MAGIC_LENGTH 4
+#define THOUSANDTHS_PER_EIGHTH 125
+
+//----------------------------------------------------------------------------
+//	Function:		writeColumn()
+//  Title:			Write column
+//	Description:	This function will write one column of a schedule block,
+//					the field at offset of every row as cents, converting
+//					BINARY_CHUNK rows at a time so nothing is allocated
+//	Input:			None
+//	Output:			the column to the file
+//	Calls:			toCents()
+//	Parameters:		file	(FILE*)
+//					rows	(const ScheduleRow*)
+//					count	(int)
+//					offset	(size_t) offsetof() the double field to write
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the write fails
+//	History Log:	10/17/2026 written for binary schedule files
+//----------------------------------------------------------------------------
+static int writeColumn(FILE* file, const ScheduleRow* rows, int count,
+	size_t offset)
+{
+	long long cents[BINARY_CHUNK];
+	int done = 0;
+	int n = 0;
+	int i = 0;
+	for (done = 0; done < count; done += n)
+	{
+		n = count - done < BINARY_CHUNK ? count - done : BINARY_CHUNK;
+		for (i = 0; i < n; i++)
+		{
+			cents[i] = toCents(*(const double*)((const char*)&rows[done + i] +
+				offset));
+		}
+		if (fwrite(cents, sizeof(cents[0]), n, file) != (size_t)n)
+		{
+			return EXIT_FAILURE;
+		}
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeScheduleBlock()
+//  Title:			Write schedule block
+//	Description:	This function will append one schedule to a binary
+//					schedule file: the header, then the payment, principal
+//					paid, interest paid and balance columns in cents. Blocks
+//					can be appended one after another to the same file
+//	Input:			None
+//	Output:			the block to the file
+//	Calls:			toCents()
+//					writeColumn()
+//	Parameters:		file		(FILE*) opened in binary mode
+//					principal	(double)
+//					monthlyRate	(double)
+//					months		(int)
+//					rows		(const ScheduleRow*)
+//					count		(int) rows filled by generateSchedule()
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when a write fails
+//	History Log:	10/17/2026 written for binary schedule files
+//----------------------------------------------------------------------------
+int writeScheduleBlock(FILE* file, double principal, double monthlyRate,
+	int months, const ScheduleRow* rows, int count)
+{
+	ScheduleHeader header;
+	memset(&header, ZERO, sizeof(header));
+	memcpy(header.magic, BINARY_MAGIC, MAGIC_LENGTH);
+	header.version = BINARY_VERSION;
+	header.principalCents = toCents(principal);
+	header.aprThousandths = (int)floor(monthlyRate * YEARLY_INTEREST_RATE *
+		THOUSAND + HALF);
+	header.months = months;
+	header.rowCount = count < ZERO ? ZERO : count;
+	if (fwrite(&header, sizeof(header), ONE, file) != ONE ||
+		writeColumn(file, rows, header.rowCount,
+			offsetof(ScheduleRow, payment)) != EXIT_SUCCESS ||
+		writeColumn(file, rows, header.rowCount,
+			offsetof(ScheduleRow, principalPaid)) != EXIT_SUCCESS ||
+		writeColumn(file, rows, header.rowCount,
+			offsetof(ScheduleRow, interestPaid)) != EXIT_SUCCESS ||
+		writeColumn(file, rows, header.rowCount,
+			offsetof(ScheduleRow, balance)) != EXIT_SUCCESS)
+	{
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeCentsBlock()
+//  Title:			Write cents block
+//	Description:	This function will append one cents schedule to a
+//					binary schedule file in the same layout as
+//					writeScheduleBlock(), with nothing to round
+//	Input:			None
+//	Output:			the block to the file
+//	Calls:			None
+//	Parameters:		file			(FILE*) opened in binary mode
+//					principalCents	(long long)
+//					aprEighths		(int)
+//					months			(int)
+//					rows			(const CentsRow*)
+//					count			(int) rows filled by
+//									generateScheduleCents()
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when a write fails
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//----------------------------------------------------------------------------
+int writeCentsBlock(FILE* file, long long principalCents, int aprEighths,
+	int months, const CentsRow* rows, int count)
+{
+	ScheduleHeader header;
+	long long cents[BINARY_CHUNK];
+	int done = 0;
+	int n = 0;
+	int i = 0;
+	int column = 0;
+
+	memset(&header, ZERO, sizeof(header));
+	memcpy(header.magic, BINARY_MAGIC, MAGIC_LENGTH);
+	header.version = BINARY_VERSION;
+	header.principalCents = principalCents;
+	header.aprThousandths = aprEighths * THOUSANDTHS_PER_EIGHTH;
+	header.months = months;
+	header.rowCount = count < ZERO ? ZERO : count;
+	if (fwrite(&header, sizeof(header), ONE, file) != ONE)
+	{
+		return EXIT_FAILURE;
+	}
+	//each column is written whole before the next one starts
+	for (column = 0; column < BINARY_COLUMNS; column++)
+	{
+		for (done = 0; done < header.rowCount; done += n)
+		{
+			n = header.rowCount - done < BINARY_CHUNK ?
+				header.rowCount - done : BINARY_CHUNK;
+			for (i = 0; i < n; i++)
+			{
+				cents[i] = column == 0 ? rows[done + i].payment :
+					column == 1 ? rows[done + i].principalPaid :
+					column == 2 ? rows[done + i].interestPaid :
+					rows[done + i].balance;
+			}
+			if (fwrite(cents, sizeof(cents[0]), n, file) != (size_t)n)
+			{
+				return EXIT_FAILURE;
+			}
+		}
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeStatusBlock()
+//  Title:			Write status block
+//	Description:	This function will append the block of a record that
+//					could not be calculated: a header carrying the status
+//					and no rows, so the blocks after it still line up with
+//					their records
+//	Input:			None
+//	Output:			the block to the file
+//	Calls:			None
+//	Parameters:		file	(FILE*) opened in binary mode
+//					status	(int) the AMORT_ status of the record
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the write fails
+//	History Log:	10/17/2026 written so a bad record keeps its place
+//----------------------------------------------------------------------------
+int writeStatusBlock(FILE* file, int status)
+{
+	ScheduleHeader header;
+	memset(&header, ZERO, sizeof(header));
+	memcpy(header.magic, BINARY_MAGIC, MAGIC_LENGTH);
+	header.version = BINARY_VERSION;
+	header.status = status;
+	return fwrite(&header, sizeof(header), ONE, file) == ONE ?
+		EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		openScheduleFile()
+//  Title:			Open schedule file
+//	Description:	This function will map a binary schedule file so its
+//					blocks can be read in place with readNextSchedule()
+//	Input:			the file
+//	Output:			None
+//	Calls:			mapFile()
+//	Parameters:		schedules	(ScheduleFile*)
+//					name		(const char*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when it cannot be mapped
+//	History Log:	10/17/2026 written for binary schedule files
+//----------------------------------------------------------------------------
+int openScheduleFile(ScheduleFile* schedules, const char* name)
+{
+	schedules->offset = 0;
+	return mapFile(&schedules->map, name);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readNextSchedule()
+//  Title:			Read next schedule
+//	Description:	This function will point view at the next block of the
+//					mapped file without copying it. The columns stay valid
+//					until closeScheduleFile()
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		schedules	(ScheduleFile*)
+//					view		(ScheduleView*)
+//  Returns:		SCHEDULE_FOUND, SCHEDULE_END after the last block, or
+//					SCHEDULE_BAD when the block is damaged or cut short
+//	History Log:	10/17/2026 written for binary schedule files
+//----------------------------------------------------------------------------
+int readNextSchedule(ScheduleFile* schedules, ScheduleView* view)
+{
+	const char* block = schedules->map.data + schedules->offset;
+	size_t left = schedules->map.size - schedules->offset;
+	const ScheduleHeader* header = (const ScheduleHeader*)block;
+	const long long* columns = NULL;
+	size_t rows = 0;
+
+	if (left == ZERO)
+	{
+		return SCHEDULE_END;
+	}
+	if (left < sizeof(ScheduleHeader) ||
+		memcmp(header->magic, BINARY_MAGIC, MAGIC_LENGTH) != ZERO ||
+		header->version != BINARY_VERSION || header->rowCount < ZERO)
+	{
+		return SCHEDULE_BAD;
+	}
+	rows = (size_t)header->rowCount;
+	left -= sizeof(ScheduleHeader);
+	if (rows > left / (BINARY_COLUMNS * sizeof(long long)))
+	{
+		return SCHEDULE_BAD;
+	}
+	columns = (const long long*)(block + sizeof(ScheduleHeader));
+	view->header = header;
+	view->payment = columns;
+	view->principalPaid = columns + rows;
+	view->interestPaid = columns + rows * 2;
+	view->balance = columns + rows * 3;
+	schedules->offset += sizeof(ScheduleHeader) +
+		rows * BINARY_COLUMNS * sizeof(long long);
+	return SCHEDULE_FOUND;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		closeScheduleFile()
+//  Title:			Close schedule file
+//	Description:	This function will unmap a binary schedule file
+//	Input:			None
+//	Output:			None
+//	Calls:			unmapFile()
+//	Parameters:		schedules	(ScheduleFile*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for binary schedule files
+//----------------------------------------------------------------------------
+void closeScheduleFile(ScheduleFile* schedules)
+{
+	unmapFile(&schedules->map);
+	schedules->offset = 0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeLoanSchedule()
+//  Title:			Write loan schedule
+//	Description:	This function will write the table of one calculated
+//					loan as a schedule block, in whole cents when the loan
+//					is in ARITHMETIC_CENTS, the APR is on the grid and the
+//					balances fit, the same choice printTable() makes.
+//					*rows grows when a loan needs more months than it holds
+//	Input:			None
+//	Output:			None
+//	Calls:			toAprEighths()
+//					generateScheduleCents()
+//					writeCentsBlock()
+//					generateSchedule()
+//					writeScheduleBlock()
+//	Parameters:		file		(FILE*)
+//					loan		(const AmortResult*)
+//					rows		(void**) the row buffer, realloc()ed
+//					capacity	(int*) months *rows holds
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when memory runs out or a
+//					write fails
+//	History Log:	10/17/2026 written for binary schedule files
+//					10/17/2026 arithmetic read from the loan
+//----------------------------------------------------------------------------
+static int writeLoanSchedule(FILE* file, const AmortResult* loan,
+	void** rows, int* capacity)
+{
+	void* grown = NULL;
+	int aprEighths = 0;
+	int count = 0;
+
+	if (loan->months > *capacity)
+	{
+		//the same buffer holds whichever kind of row is generated
+		grown = realloc(*rows, (size_t)loan->months *
+			(sizeof(ScheduleRow) > sizeof(CentsRow) ? sizeof(ScheduleRow) :
+			sizeof(CentsRow)));
+		if (grown == NULL)
+		{
+			return EXIT_FAILURE;
+		}
+		*rows = grown;
+		*capacity = loan->months;
+	}
+	if (loan->arithmetic == ARITHMETIC_CENTS &&
+		toAprEighths(loan->monthlyRate, &aprEighths))
+	{
+		count = generateScheduleCents(toCents(loan->principal),
+			toCents(loan->payment), aprEighths, loan->months,
+			(CentsRow*)*rows);
+	}
+	if (count > ZERO)
+	{
+		return writeCentsBlock(file, toCents(loan->principal), aprEighths,
+			loan->months, (CentsRow*)*rows, count);
+	}
+	count = generateSchedule(loan->principal, loan->payment,
+		loan->monthlyRate, loan->months, (ScheduleRow*)*rows);
+	return writeScheduleBlock(file, loan->principal, loan->monthlyRate,
+		loan->months, (ScheduleRow*)*rows, count);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runScheduleFile()
+//  Title:			Run schedule file
+//	Description:	This function will calculate every loan of a batch file
+//					and write its whole amortization table to a binary
+//					schedule file, one block per loan in input order. Lines
+//					that break a rule are reported with their line number
+//					and get a block of no rows carrying the status
+//	Input:			the batch file
+//	Output:			the binary schedule file, errors to stderr
+//	Calls:			openLoanReader()
+//					readLoanLine()
+//					getLoanRequest()
+//					amortCalculate()
+//					amortStatusText()
+//					writeStatusBlock()
+//					writeLoanSchedule()
+//					closeLoanReader()
+//	Parameters:		inName		(const char*)
+//					outName		(const char*)
+//					arithmetic	(int) ARITHMETIC_DOUBLE or ARITHMETIC_CENTS
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when a file cannot be used
+//					or memory runs out
+//	History Log:	10/17/2026 written for binary schedule files
+//					10/17/2026 arithmetic passed in
+//					10/17/2026 a status block for every bad line
+//----------------------------------------------------------------------------
+int runScheduleFile(const char* inName, const char* outName, int arithmetic)
+{
+	LoanReader reader;
+	LoanLine line;
+	AmortRequest request;
+	AmortResult loan;
+	FILE * outFileHandle = NULL;
+	void * rows = NULL;
+	int capacity = 0;
+	int status = AMORT_OK;
+	int returnValue = EXIT_SUCCESS;
+
+	if (openLoanReader(&reader, inName) != EXIT_SUCCESS ||
+		(outFileHandle = fopen(outName, "wb")) == NULL)
+	{
+		fprintf(stderr, "Could not open %s or %s\n", inName, outName);
+		closeLoanReader(&reader);
+		return EXIT_FAILURE;
+	}
+	while (returnValue == EXIT_SUCCESS && readLoanLine(&reader, &line))
+	{
+		status = line.status;
+		if (status == AMORT_OK)
+		{
+			getLoanRequest(&line, &request);
+			request.arithmetic = arithmetic;
+			status = amortCalculate(&request, &loan);
+		}
+		if (status != AMORT_OK)
+		{
+			fprintf(stderr, "line %ld: %s\n", line.lineNumber,
+				amortStatusText(status));
+		}
+		if ((status != AMORT_OK ? writeStatusBlock(outFileHandle, status) :
+			writeLoanSchedule(outFileHandle, &loan, &rows, &capacity)) !=
+			EXIT_SUCCESS)
+		{
+			fprintf(stderr, "Could not write the table of line %ld\n",
+				line.lineNumber);
+			returnValue = EXIT_FAILURE;
+		}
+	}
+	closeLoanReader(&reader);
+	if (fclose(outFileHandle) != ZERO)
+	{
+		returnValue = EXIT_FAILURE;
+	}
+	free(rows);
+	return returnValue;
+}
@@ -0,0 +1,60 @@
+#ifndef AMORTBINARY_H
+#define AMORTBINARY_H
+#include <stdio.h>
+#include "AmortSchedule.h"
+#include "AmortCents.h"
+#include "AmortApi.h"
+#include "AmortMap.h"
+#define BINARY_MAGIC "AMSB"
+#define BINARY_VERSION 1
+#define BINARY_COLUMNS 4
+#define BINARY_CHUNK 512
+#define SCHEDULE_FOUND 1
+#define SCHEDULE_END 0
+#define SCHEDULE_BAD -1
+//----------------------------------------------------------------------------
+// ScheduleHeader: starts every schedule block of a binary schedule file.
+//		It is followed by rowCount payments, then rowCount principal paid,
+//		rowCount interest paid and rowCount balances, all as long long
+//		cents in the byte order of the machine that wrote the file
+//		aprThousandths	the APR times 1000, as printed in the text table
+//		status		AMORT_OK, or the rule the record broke; such a block
+//					has no rows, so block i is always record i of the
+//					batch file
+//----------------------------------------------------------------------------
+typedef struct ScheduleHeader {
+	char magic[4];
+	int version;
+	long long principalCents;
+	int aprThousandths;
+	int months;
+	int rowCount;
+	int status;
+} ScheduleHeader;
+//----------------------------------------------------------------------------
+// ScheduleView: one schedule block read in place from a mapped file
+//----------------------------------------------------------------------------
+typedef struct ScheduleView {
+	const ScheduleHeader* header;
+	const long long* payment;
+	const long long* principalPaid;
+	const long long* interestPaid;
+	const long long* balance;
+} ScheduleView;
+//----------------------------------------------------------------------------
+// ScheduleFile: a mapped binary schedule file and how far it has been read
+//----------------------------------------------------------------------------
+typedef struct ScheduleFile {
+	MappedFile map;
+	size_t offset;
+} ScheduleFile;
+int writeScheduleBlock(FILE* file, double principal, double monthlyRate,
+	int months, const ScheduleRow* rows, int count);
+int writeCentsBlock(FILE* file, long long principalCents, int aprEighths,
+	int months, const CentsRow* rows, int count);
+int writeStatusBlock(FILE* file, int status);
+int openScheduleFile(ScheduleFile* schedules, const char* name);
+int readNextSchedule(ScheduleFile* schedules, ScheduleView* view);
+void closeScheduleFile(ScheduleFile* schedules);
+int runScheduleFile(const char* inName, const char* outName, int arithmetic);
+#endif
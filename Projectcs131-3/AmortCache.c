@@ -0,0 +1,387 @@
+#include "AmortCache.h"
+#include "AmortCents.h"
+#include "AmortThread.h"
+#include <string.h>
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define EIGHTHS_PER_POINT 8
+
+//----------------------------------------------------------------------------
+// QuoteKey: a request after the rounding amortCalculate() does; the fields
+// the mode calculates are 0. The arithmetic is part of it, since a cents
+// payment can be a cent away from the double one
+//----------------------------------------------------------------------------
+typedef struct QuoteKey {
+	long long principalCents;
+	long long paymentCents;
+	int aprEighths;
+	int months;
+	char mode;
+	char arithmetic;
+} QuoteKey;
+//----------------------------------------------------------------------------
+// QuoteEntry: one way of a set
+//		used		TRUE once the way holds a quote
+//		referenced	the CLOCK bit, set by every hit and cleared as the
+//					hand passes
+//----------------------------------------------------------------------------
+typedef struct QuoteEntry {
+	QuoteKey key;
+	AmortResult result;
+	char used;
+	char referenced;
+} QuoteEntry;
+//----------------------------------------------------------------------------
+// QuoteSet: CACHE_WAYS quotes whose keys hash to the same set and the
+// CLOCK hand that picks the next one to replace
+//----------------------------------------------------------------------------
+typedef struct QuoteSet {
+	QuoteEntry ways[CACHE_WAYS];
+	int hand;
+} QuoteSet;
+//----------------------------------------------------------------------------
+// QuoteStripe: the lock for every set whose number is the stripe number
+// modulo CACHE_STRIPES, and the counters kept under it
+//----------------------------------------------------------------------------
+typedef struct QuoteStripe {
+	AmortMutex lock;
+	long long hits;
+	long long misses;
+	long long evictions;
+	long long bypassed;
+	int entries;
+} QuoteStripe;
+
+static QuoteSet sets[CACHE_SETS];
+static QuoteStripe stripes[CACHE_STRIPES];
+static int cacheReady = FALSE;
+
+//----------------------------------------------------------------------------
+//	Function:		initQuoteCache()
+//  Title:			Initialize quote cache
+//	Description:	This function will set up the locks of the quote cache.
+//					Like initGrowthTable() it has to run before any thread
+//					calls cachedCalculate(); until it has, cachedCalculate()
+//					just calls amortCalculate()
+//	Input:			None
+//	Output:			None
+//	Calls:			initMutex()
+//	Parameters:		None
+//  Returns:		EXIT_SUCCESS
+//	History Log:	10/17/2026 written for the quote cache
+//----------------------------------------------------------------------------
+int initQuoteCache(void)
+{
+	int i = 0;
+	if (cacheReady)
+	{
+		return EXIT_SUCCESS;
+	}
+	memset(sets, ZERO, sizeof(sets));
+	memset(stripes, ZERO, sizeof(stripes));
+	for (i = 0; i < CACHE_STRIPES; i++)
+	{
+		initMutex(&stripes[i].lock);
+	}
+	cacheReady = TRUE;
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeQuoteKey()
+//  Title:			Make quote key
+//	Description:	This function will round a request the way
+//					amortCalculate() rounds it. Two requests with the same
+//					key get the same result, as long as both pass the checks
+//					amortCalculate() makes on the values before rounding,
+//					so a request failing one of those is not keyed
+//	Input:			None
+//	Output:			None
+//	Calls:			roundToOneEighth()
+//					roundToNearestCent()
+//					toCents()
+//	Parameters:		request	(const AmortRequest*)
+//					key		(QuoteKey*)
+//  Returns:		TRUE when the request has a key
+//	History Log:	10/17/2026 written for the quote cache
+//					10/17/2026 arithmetic keyed
+//----------------------------------------------------------------------------
+static int makeQuoteKey(const AmortRequest* request, QuoteKey* key)
+{
+	double eighths = 0.0;
+	memset(key, ZERO, sizeof(*key));
+	key->mode = request->mode;
+	key->arithmetic = request->arithmetic == ARITHMETIC_CENTS ?
+		ARITHMETIC_CENTS : ARITHMETIC_DOUBLE;
+	if (key->mode != 'P' && key->mode != 'L' && key->mode != 'N' &&
+		key->mode != 'I')
+	{
+		return FALSE;
+	}
+	if (key->mode != 'I')
+	{
+		if (!(request->apr >= 0))
+		{
+			return FALSE;
+		}
+		eighths = roundToOneEighth(request->apr) * EIGHTHS_PER_POINT;
+		if (!(eighths < CACHE_MAX_EIGHTHS))
+		{
+			return FALSE;
+		}
+		key->aprEighths = (int)eighths;
+	}
+	if (key->mode != 'L')
+	{
+		if (!(request->principal > 0 &&
+			request->principal < CACHE_MAX_AMOUNT))
+		{
+			return FALSE;
+		}
+		key->principalCents = toCents(roundToNearestCent(request->principal));
+	}
+	if (key->mode != 'P')
+	{
+		if (!(request->payment > 0 && request->payment < CACHE_MAX_AMOUNT))
+		{
+			return FALSE;
+		}
+		key->paymentCents = toCents(roundToNearestCent(request->payment));
+	}
+	if (key->mode != 'N')
+	{
+		key->months = request->months;
+	}
+	return TRUE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		hashQuoteKey()
+//  Title:			Hash quote key
+//	Description:	This function will mix every field of a key into a set
+//					number (the splitmix64 finalizer)
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		key	(const QuoteKey*)
+//  Returns:		a set number from 0 to CACHE_SETS - 1
+//	History Log:	10/17/2026 written for the quote cache
+//					10/17/2026 arithmetic mixed in
+//----------------------------------------------------------------------------
+static int hashQuoteKey(const QuoteKey* key)
+{
+	unsigned long long hash = (unsigned long long)key->principalCents;
+	hash = hash * 31 + (unsigned long long)key->paymentCents;
+	hash = hash * 31 + (unsigned int)key->aprEighths;
+	hash = hash * 31 + (unsigned int)key->months;
+	hash = hash * 31 + (unsigned char)key->mode;
+	hash = hash * 31 + (unsigned char)key->arithmetic;
+	hash ^= hash >> 30;
+	hash *= 0xBF58476D1CE4E5B9ULL;
+	hash ^= hash >> 27;
+	hash *= 0x94D049BB133111EBULL;
+	hash ^= hash >> 31;
+	return (int)(hash % CACHE_SETS);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		sameQuoteKey()
+//  Title:			Same quote key
+//	Description:	This function will compare two keys field by field
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		left	(const QuoteKey*)
+//					right	(const QuoteKey*)
+//  Returns:		TRUE when they are equal
+//	History Log:	10/17/2026 written for the quote cache
+//					10/17/2026 arithmetic compared
+//----------------------------------------------------------------------------
+static int sameQuoteKey(const QuoteKey* left, const QuoteKey* right)
+{
+	return left->principalCents == right->principalCents &&
+		left->paymentCents == right->paymentCents &&
+		left->aprEighths == right->aprEighths &&
+		left->months == right->months && left->mode == right->mode &&
+		left->arithmetic == right->arithmetic;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		findQuote()
+//  Title:			Find quote
+//	Description:	This function will look for a key among the ways of its
+//					set. The caller holds the set's stripe lock
+//	Input:			None
+//	Output:			None
+//	Calls:			sameQuoteKey()
+//	Parameters:		set	(QuoteSet*)
+//					key	(const QuoteKey*)
+//  Returns:		the entry, or NULL when the set does not hold the key
+//	History Log:	10/17/2026 written for the quote cache
+//----------------------------------------------------------------------------
+static QuoteEntry* findQuote(QuoteSet* set, const QuoteKey* key)
+{
+	int i = 0;
+	for (i = 0; i < CACHE_WAYS; i++)
+	{
+		if (set->ways[i].used && sameQuoteKey(&set->ways[i].key, key))
+		{
+			return &set->ways[i];
+		}
+	}
+	return NULL;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		storeQuote()
+//  Title:			Store quote
+//	Description:	This function will put a result in its set, in the
+//					first empty way or else in the first way the CLOCK hand
+//					finds without its referenced bit. The caller holds the
+//					set's stripe lock
+//	Input:			None
+//	Output:			None
+//	Calls:			findQuote()
+//	Parameters:		set		(QuoteSet*)
+//					stripe	(QuoteStripe*)
+//					key		(const QuoteKey*)
+//					result	(const AmortResult*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the quote cache
+//----------------------------------------------------------------------------
+static void storeQuote(QuoteSet* set, QuoteStripe* stripe,
+	const QuoteKey* key, const AmortResult* result)
+{
+	QuoteEntry* entry = NULL;
+	int i = 0;
+
+	//another thread may have calculated the same quote meanwhile
+	if (findQuote(set, key) != NULL)
+	{
+		return;
+	}
+	for (i = 0; i < CACHE_WAYS && entry == NULL; i++)
+	{
+		if (!set->ways[i].used)
+		{
+			entry = &set->ways[i];
+			stripe->entries++;
+		}
+	}
+	while (entry == NULL)
+	{
+		if (set->ways[set->hand].referenced)
+		{
+			set->ways[set->hand].referenced = FALSE;
+		}
+		else
+		{
+			entry = &set->ways[set->hand];
+			stripe->evictions++;
+		}
+		set->hand = (set->hand + ONE) % CACHE_WAYS;
+	}
+	entry->key = *key;
+	entry->result = *result;
+	entry->used = TRUE;
+	entry->referenced = FALSE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		cachedCalculate()
+//  Title:			Cached calculate
+//	Description:	This function will give the same answer as
+//					amortCalculate(), from the cache when the same rounded
+//					request was answered before. The calculation runs
+//					without the lock, so a slow getInterestRate() holds up
+//					no other quote of its stripe
+//	Input:			None
+//	Output:			None
+//	Calls:			makeQuoteKey()
+//					hashQuoteKey()
+//					findQuote()
+//					storeQuote()
+//					amortCalculate()
+//					lockMutex()
+//					unlockMutex()
+//	Parameters:		request	(const AmortRequest*)
+//					result	(AmortResult*)
+//  Returns:		AMORT_OK, or the AMORT_ status of the broken rule, which
+//					is also left in result->status
+//	History Log:	10/17/2026 written for the quote cache
+//----------------------------------------------------------------------------
+int cachedCalculate(const AmortRequest* request, AmortResult* result)
+{
+	QuoteKey key;
+	QuoteSet* set = NULL;
+	QuoteStripe* stripe = NULL;
+	QuoteEntry* entry = NULL;
+	int setNumber = 0;
+
+	if (!cacheReady)
+	{
+		return amortCalculate(request, result);
+	}
+	if (!makeQuoteKey(request, &key))
+	{
+		stripe = &stripes[ZERO];
+		lockMutex(&stripe->lock);
+		stripe->bypassed++;
+		unlockMutex(&stripe->lock);
+		return amortCalculate(request, result);
+	}
+	setNumber = hashQuoteKey(&key);
+	set = &sets[setNumber];
+	stripe = &stripes[setNumber % CACHE_STRIPES];
+	lockMutex(&stripe->lock);
+	entry = findQuote(set, &key);
+	if (entry != NULL)
+	{
+		entry->referenced = TRUE;
+		*result = entry->result;
+		stripe->hits++;
+		unlockMutex(&stripe->lock);
+		return result->status;
+	}
+	stripe->misses++;
+	unlockMutex(&stripe->lock);
+	amortCalculate(request, result);
+	lockMutex(&stripe->lock);
+	storeQuote(set, stripe, &key, result);
+	unlockMutex(&stripe->lock);
+	return result->status;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getQuoteCacheStats()
+//  Title:			Get quote cache stats
+//	Description:	This function will add up the counters of every stripe
+//	Input:			None
+//	Output:			None
+//	Calls:			lockMutex()
+//					unlockMutex()
+//	Parameters:		stats	(QuoteCacheStats*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the quote cache
+//----------------------------------------------------------------------------
+void getQuoteCacheStats(QuoteCacheStats* stats)
+{
+	int i = 0;
+	memset(stats, ZERO, sizeof(*stats));
+	if (!cacheReady)
+	{
+		return;
+	}
+	for (i = 0; i < CACHE_STRIPES; i++)
+	{
+		lockMutex(&stripes[i].lock);
+		stats->hits += stripes[i].hits;
+		stats->misses += stripes[i].misses;
+		stats->evictions += stripes[i].evictions;
+		stats->bypassed += stripes[i].bypassed;
+		stats->entries += stripes[i].entries;
+		unlockMutex(&stripes[i].lock);
+	}
+}
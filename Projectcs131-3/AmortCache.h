@@ -0,0 +1,28 @@
+#ifndef AMORTCACHE_H
+#define AMORTCACHE_H
+#include "AmortApi.h"
+#define CACHE_SETS 1024
+#define CACHE_WAYS 8
+#define CACHE_STRIPES 64
+#define CACHE_MAX_EIGHTHS 1000000
+#define CACHE_MAX_AMOUNT 1e13
+//----------------------------------------------------------------------------
+// QuoteCacheStats: what the quote cache has done since initQuoteCache()
+//		hits		quotes answered from the cache
+//		misses		quotes that had to be calculated
+//		evictions	quotes dropped to make room for newer ones
+//		bypassed	requests that cannot be keyed and went straight to
+//					amortCalculate()
+//		entries		quotes held now
+//----------------------------------------------------------------------------
+typedef struct QuoteCacheStats {
+	long long hits;
+	long long misses;
+	long long evictions;
+	long long bypassed;
+	int entries;
+} QuoteCacheStats;
+int initQuoteCache(void);
+int cachedCalculate(const AmortRequest* request, AmortResult* result);
+void getQuoteCacheStats(QuoteCacheStats* stats);
+#endif
@@ -0,0 +1,344 @@
+#include "AmortCents.h"
+#include <limits.h>
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define HALF 0.5
+#define HUNDRED 100
+#define EIGHTHS_PER_POINT 8
+#define YEARLY_INTEREST_RATE 1200
+#define CENTS_HEADROOM 4
+#define CENTS_TOO_SMALL (LLONG_MAX / 2)
+
+//----------------------------------------------------------------------------
+//	Function:		toCents()
+//  Title:			To cents
+//	Description:	This function will turn a dollar amount into whole cents,
+//					rounding half a cent up like roundToNearestCent()
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		amount	(double)
+//  Returns:		the amount in cents
+//	History Log:	10/17/2026 written for binary schedule files
+//----------------------------------------------------------------------------
+long long toCents(double amount)
+{
+	return (long long)floor(amount * HUNDRED + HALF);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		toAprEighths()
+//  Title:			To APR eighths
+//	Description:	This function will find the APR in eighths of a point of
+//					a monthly rate
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		monthlyRate	(double)
+//					aprEighths	(int*) the nearest eighth
+//  Returns:		TRUE when the rate is exactly that eighth divided by 1200,
+//					as readApr() gives, FALSE when it had to be rounded
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//----------------------------------------------------------------------------
+int toAprEighths(double monthlyRate, int* aprEighths)
+{
+	double position = monthlyRate * YEARLY_INTEREST_RATE * EIGHTHS_PER_POINT;
+	if (!(position >= ZERO && position < INT_MAX))
+	{
+		*aprEighths = ZERO;
+		return FALSE;
+	}
+	*aprEighths = (int)(position + HALF);
+	return ((double)*aprEighths / EIGHTHS_PER_POINT) / YEARLY_INTEREST_RATE ==
+		monthlyRate;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getBalanceLimit()
+//  Title:			Get balance limit
+//	Description:	This function will give the largest balance in cents a
+//					cents schedule can carry at a rate: a quarter of
+//					LLONG_MAX over the larger of aprEighths and
+//					CENTS_RATE_SCALE, so balance * aprEighths and a balance
+//					plus its interest both fit a long long with room to
+//					spare. It is about $2.4 trillion for any APR up to 1200%
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		aprEighths	(int)
+//  Returns:		the limit in cents
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//----------------------------------------------------------------------------
+long long getBalanceLimit(int aprEighths)
+{
+	return LLONG_MAX / CENTS_HEADROOM /
+		(aprEighths > CENTS_RATE_SCALE ? aprEighths : CENTS_RATE_SCALE);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getShortfallCents()
+//  Title:			Get shortfall cents
+//	Description:	This function will run a cents schedule without keeping
+//					its rows and give how much its last payment is above the
+//					level payment: above zero when the level payment is too
+//					small to retire the loan in time, zero or below when it
+//					is enough. A payment that retires the loan early keeps
+//					going into a negative balance rather than ending the
+//					table, which leaves the sign alone but keeps the
+//					shortfall a straight line in the payment. A balance
+//					past getBalanceLimit() either way gives CENTS_TOO_SMALL
+//					with its sign
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		principalCents	(long long)
+//					paymentCents	(long long)
+//					aprEighths		(int)
+//					months			(int)
+//					limit			(long long) from getBalanceLimit()
+//  Returns:		the last payment less paymentCents
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//----------------------------------------------------------------------------
+static long long getShortfallCents(long long principalCents,
+	long long paymentCents, int aprEighths, int months, long long limit)
+{
+	long long balance = principalCents;
+	long long interest = 0;
+	int row = 0;
+
+	for (row = 0; row < months - ONE; row++)
+	{
+		if (balance > limit)
+		{
+			return CENTS_TOO_SMALL;
+		}
+		if (balance < -limit)
+		{
+			return -CENTS_TOO_SMALL;
+		}
+		interest = (balance * aprEighths + CENTS_RATE_SCALE / 2) /
+			CENTS_RATE_SCALE;
+		balance -= paymentCents - interest;
+	}
+	if (balance > limit)
+	{
+		return CENTS_TOO_SMALL;
+	}
+	if (balance < -limit)
+	{
+		return -CENTS_TOO_SMALL;
+	}
+	return balance + (balance * aprEighths + CENTS_RATE_SCALE / 2) /
+		CENTS_RATE_SCALE - paymentCents;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getPaymentCents()
+//  Title:			Get payment cents
+//	Description:	This function will give the level monthly payment in
+//					cents with integer math only: the smallest payment
+//					whose generateScheduleCents() table is paid off in
+//					months rows with no last payment above it. The
+//					shortfall of a payment is nearly a straight line, so
+//					secant steps inside a bracket of a payment known to be
+//					too small and one known to be enough find it in a few
+//					runs of the table, halving the bracket instead when a
+//					balance gets past getBalanceLimit(). It is within a
+//					cent of getPaymentAmount(), which rounds the exact
+//					annuity up rather than rounding each month's interest
+//	Input:			None
+//	Output:			None
+//	Calls:			getBalanceLimit()
+//					getShortfallCents()
+//	Parameters:		principalCents	(long long)
+//					aprEighths		(int)
+//					months			(int)
+//  Returns:		the payment in cents, or 0 when the loan is not above
+//					zero or its principal is past getBalanceLimit()
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//					10/17/2026 integer secant search instead of
+//					getPaymentAmount()
+//----------------------------------------------------------------------------
+long long getPaymentCents(long long principalCents, int aprEighths,
+	int months)
+{
+	long long limit = getBalanceLimit(aprEighths);
+	long long low = 0;
+	long long high = 0;
+	long long last = 0;
+	long long lastShortfall = 0;
+	long long guess = 0;
+	long long shortfall = 0;
+	long long next = 0;
+	long long slope = 0;
+
+	if (principalCents <= ZERO || months <= ZERO || aprEighths < ZERO ||
+		principalCents > limit)
+	{
+		return ZERO;
+	}
+	//without interest the payment is the principal over the term, and
+	//no payment a cent below it is ever enough
+	high = (principalCents + months - ONE) / months;
+	if (aprEighths == ZERO)
+	{
+		return high;
+	}
+	//paying only the first month's interest never brings the balance
+	//down, and paying it on top of the interest-free payment always does
+	//since the interest only falls
+	low = (principalCents * aprEighths + CENTS_RATE_SCALE / 2) /
+		CENTS_RATE_SCALE;
+	low = low > high - ONE ? low : high - ONE;
+	high += (principalCents * aprEighths + CENTS_RATE_SCALE - ONE) /
+		CENTS_RATE_SCALE;
+	last = low;
+	lastShortfall = getShortfallCents(principalCents, low, aprEighths,
+		months, limit);
+	guess = high;
+	shortfall = getShortfallCents(principalCents, high, aprEighths, months,
+		limit);
+	while (high - low > ONE)
+	{
+		if (shortfall == CENTS_TOO_SMALL || shortfall == -CENTS_TOO_SMALL ||
+			lastShortfall == CENTS_TOO_SMALL ||
+			lastShortfall == -CENTS_TOO_SMALL)
+		{
+			next = low + (high - low) / 2;
+		}
+		else
+		{
+			//the line through the last two payments tried says where the
+			//shortfall crosses zero; a payment that is already enough
+			//tries at least the cent below it
+			slope = (lastShortfall - shortfall) / (guess - last);
+			slope = slope > ZERO ? slope : ONE;
+			next = shortfall > ZERO ?
+				guess + (shortfall + slope - ONE) / slope :
+				guess - (-shortfall / slope > ONE ? -shortfall / slope : ONE);
+			next = next <= low ? low + ONE : next >= high ? high - ONE : next;
+		}
+		last = guess;
+		lastShortfall = shortfall;
+		guess = next;
+		shortfall = getShortfallCents(principalCents, guess, aprEighths,
+			months, limit);
+		if (shortfall > ZERO)
+		{
+			low = guess;
+		}
+		else
+		{
+			high = guess;
+		}
+	}
+	return high;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getSchedulePayment()
+//  Title:			Get schedule payment
+//	Description:	This function will give the level payment for an
+//					arithmetic: getPaymentCents() in dollars when
+//					arithmetic is ARITHMETIC_CENTS and the APR is on the
+//					grid, so the payment shown and the cents table come
+//					from integer math alone, or getPaymentAmount()
+//	Input:			None
+//	Output:			None
+//	Calls:			toAprEighths()
+//					getPaymentCents()
+//					getPaymentAmount()
+//	Parameters:		months		(int)
+//					principal	(double)
+//					monthlyRate	(double)
+//					arithmetic	(int) ARITHMETIC_DOUBLE or ARITHMETIC_CENTS
+//  Returns:		the payment
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//					10/17/2026 arithmetic passed in
+//----------------------------------------------------------------------------
+double getSchedulePayment(int months, double principal, double monthlyRate,
+	int arithmetic)
+{
+	long long paymentCents = 0;
+	int aprEighths = 0;
+
+	if (arithmetic == ARITHMETIC_CENTS &&
+		toAprEighths(monthlyRate, &aprEighths))
+	{
+		paymentCents = getPaymentCents(toCents(principal), aprEighths,
+			months);
+		if (paymentCents > ZERO)
+		{
+			return (double)paymentCents / HUNDRED;
+		}
+	}
+	return getPaymentAmount(months, principal, monthlyRate);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		generateScheduleCents()
+//  Title:			Generate schedule in cents
+//	Description:	This function will fill the amortization table in whole
+//					cents. Each month's interest is the balance times the
+//					rate rounded to the nearest cent with integer math, the
+//					rest of the level payment goes to principal and the last
+//					row pays off whatever is left, so principal paid always
+//					adds up to the loan and no row needs ceil() or floor().
+//					A payment that retires the loan early ends the table.
+//					A balance past getBalanceLimit() would overflow
+//					balance * aprEighths, so such a table is not filled and
+//					the caller prints the double one instead
+//	Input:			None
+//	Output:			None
+//	Calls:			getBalanceLimit()
+//	Parameters:		principalCents	(long long)
+//					paymentCents	(long long)
+//					aprEighths		(int)
+//					months			(int)
+//					rows			(CentsRow*) room for months rows
+//  Returns:		the number of rows filled, or 0 when a balance is past
+//					getBalanceLimit()
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//					10/17/2026 no table past getBalanceLimit()
+//----------------------------------------------------------------------------
+int generateScheduleCents(long long principalCents, long long paymentCents,
+	int aprEighths, int months, CentsRow* rows)
+{
+	long long limit = getBalanceLimit(aprEighths);
+	long long balance = principalCents;
+	long long interest = 0;
+	long long principalPaid = 0;
+	int row = 0;
+
+	if (months <= ZERO || aprEighths < ZERO)
+	{
+		return ZERO;
+	}
+	for (row = 0; row < months; row++)
+	{
+		if (balance > limit)
+		{
+			return ZERO;
+		}
+		interest = (balance * aprEighths + CENTS_RATE_SCALE / 2) /
+			CENTS_RATE_SCALE;
+		principalPaid = paymentCents - interest;
+		rows[row].month = row + ONE;
+		if (row == months - ONE || principalPaid >= balance)
+		{
+			rows[row].payment = balance + interest;
+			rows[row].principalPaid = balance;
+			rows[row].interestPaid = interest;
+			rows[row].balance = 0;
+			return row + ONE;
+		}
+		balance -= principalPaid;
+		rows[row].payment = paymentCents;
+		rows[row].principalPaid = principalPaid;
+		rows[row].interestPaid = interest;
+		rows[row].balance = balance;
+	}
+	return months;
+}
@@ -0,0 +1,29 @@
+#ifndef AMORTCENTS_H
+#define AMORTCENTS_H
+#include "Amort.h"
+#define ARITHMETIC_DOUBLE 0
+#define ARITHMETIC_CENTS 1
+#define CENTS_RATE_SCALE 9600
+//----------------------------------------------------------------------------
+// CentsRow: one line of the amortization table in whole cents. The rate
+//		of a cents schedule is an APR in eighths of a point, so a month's
+//		interest is balance * aprEighths / CENTS_RATE_SCALE, and no balance
+//		may be past getBalanceLimit(aprEighths) so that product fits
+//----------------------------------------------------------------------------
+typedef struct CentsRow {
+	int month;
+	long long payment;
+	long long principalPaid;
+	long long interestPaid;
+	long long balance;
+} CentsRow;
+long long toCents(double amount);
+int toAprEighths(double monthlyRate, int* aprEighths);
+long long getBalanceLimit(int aprEighths);
+long long getPaymentCents(long long principalCents, int aprEighths,
+	int months);
+double getSchedulePayment(int months, double principal, double monthlyRate,
+	int arithmetic);
+int generateScheduleCents(long long principalCents, long long paymentCents,
+	int aprEighths, int months, CentsRow* rows);
+#endif
@@ -0,0 +1,476 @@
+#include "AmortConsole.h"
+#include "AmortSchedule.h"
+#include "AmortWriter.h"
+#include "AmortCents.h"
+#include <stdio.h>
+#include <stdlib.h>
+#ifndef _WIN32
+#include <termios.h>
+#include <unistd.h>
+#endif
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+
+//----------------------------------------------------------------------------
+//	Function:		readApr()
+//  Title:			read APR
+//	Description:	This function will read in the annual percentage rate
+//					from the console where user enter the apr
+//  Programmer:		Son Minh Tran
+//	Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit
+//	Input:			user input the apr		
+//	Output:			roudn to one eight and print out apr
+//	Calls:			safeReadDouble()
+//					roundToOneEighth()
+//	Parameters:		void
+//  Returns:		the APR	
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 moved to AmortConsole.c
+//----------------------------------------------------------------------------
+double readApr() {
+	double interestRate = 0.0;
+	printf("\nEnter the interest rate (APR) you will be paying"
+		"(nearest 1/8 points, >=0): ");
+	int condition = FALSE;
+	do
+	{
+		safeReadDouble(&interestRate, "Please enter a non-negative number");
+		if (interestRate < 0)
+		{
+			printf("please enter a positive value for Annual Payment Rate: ");
+			condition = TRUE;
+		}
+		else {
+			interestRate = roundToOneEighth(interestRate);
+			printf("Interest: %.3lf%c", interestRate, '%');
+			condition = FALSE;
+		}
+	} while (condition == TRUE);
+	return interestRate;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readPrincipal()
+//  Title:			read Principal
+//	Description:	This function will read in the total loan 
+//					from the console where user enter the total loan
+//  Programmer:		Son Minh Tran
+//	Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit
+//	Input:			user input the principal		
+//	Output:			roudn to nearest cent and print out the console
+//	Calls:			safeReadDouble()
+//					roundToNearestCent()
+//	Parameters:		void
+//  Returns:		the principal
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 moved to AmortConsole.c
+//----------------------------------------------------------------------------
+double readPrincipal() {
+	double loan = 0.0;
+	printf("\nEnter the amount of money to be borrowed (amount > 0): $");
+	int condition = FALSE;
+	do
+	{
+		safeReadDouble(&loan, "\nPlease enter a non-negative number");
+		if (loan <= 0)
+		{
+			printf("\nThe amount of Loan needs to be bigger than 0");
+			condition = TRUE;
+		}
+		else {
+			printf("Principal: $%.2lf", loan);
+			condition = FALSE;
+		}
+	} while (condition == TRUE);
+	return roundToNearestCent(loan);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readMonth()
+//  Title:			read Principal
+//	Description:	This function will read in the number of month 
+//					from the console where user enter the number of months
+//	Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit
+//	Input:			user input the month	
+//	Output:			print out the month
+//	Calls:			safeReadInt()
+//	Parameters:		void
+//  Returns:		the numbers of month
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 moved to AmortConsole.c
+//----------------------------------------------------------------------------
+int readMonth() {
+	int numMonth = 0;
+	int condition = FALSE;
+	printf("\nEnter the number of months you will be making "
+		"payments (0 < months <= 360): ");
+	do
+	{
+		safeReadInt(&numMonth, "\nPlease enter a non - negative"
+			"number from 0 to 360:");
+		if (numMonth <= 0 || numMonth > 360)
+		{
+			puts("\nYou have to input positive number for number of months");
+			condition = TRUE;
+		}
+		else {
+			printf("Number of Months to pay: %d", numMonth);
+			condition = FALSE;
+		}
+	} while (condition == TRUE);
+	return numMonth;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readPayment()
+//  Title:			read Payment
+//	Description:	This function will read in amount of monthly payment
+//					from the console where user enter the monthly payment
+//	Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit
+//	Input:			user input the amount of monthly payment	
+//	Output:			roudn to nearest cent and print out the monthly payment
+//	Calls:			safeReadDouble()
+//					roundToNearestCent()
+//	Parameters:		void
+//  Returns:		the amount of monthly payment
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 moved to AmortConsole.c
+//----------------------------------------------------------------------------
+double readPayment() {
+	double payment = 0.0;
+	int condition = FALSE;
+	printf("\nEnter the amount of the monthly payment (amount > 0): $");
+	do
+	{
+		safeReadDouble(&payment, "\nPlease enter a non-negative number");
+		if (payment <= 0)
+		{
+			puts("\nPlease enter number bigger" 
+				"than 0 for your monthly payment");
+			condition = TRUE;
+		}
+		else {
+			printf("Payment: $%.2lf per month", payment);
+			condition = FALSE;
+		}
+	} while (condition == TRUE);
+	return roundToNearestCent(payment);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		safeReadDouble()
+//  Title:			Read in safe double value
+//	Description:	This function will read in the right (double) input number 
+//					into the program
+//  Programmer:		Son Minh Tran
+//  Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit 
+//	Input:			read in a number
+//					number_ptr (double*)
+//	Output:			a prompt if a invalid number has been entered
+//	Calls:			cleanBuffer()
+//	Parameters:		number_ptr (int*)
+//					prompt (const char*)
+//  Returns:		None
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 moved to AmortConsole.c
+//----------------------------------------------------------------------------
+void safeReadDouble(double * number_ptr, const char * prompt)
+{
+	while ((scanf("%lf", number_ptr)) != ONE)
+	{
+		puts(prompt);
+		cleanBuffer();
+	}
+	cleanBuffer();
+}
+
+//----------------------------------------------------------------------------
+//	Function:		safeReadInt()
+//  Title:			Read in safe integer value
+//	Description:	This function will read in the right (integer) input  
+//					number into the program
+//  Programmer:		Son Minh Tran
+//  Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit 
+//	Input:			read in a number
+//					number_ptr (double*)
+//	Output:			a prompt if a invalid number has been entered
+//	Calls:			cleanBuffer()
+//	Parameters:		number_ptr (int*)
+//					prompt (const char*)
+//  Returns:		None
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 moved to AmortConsole.c
+//----------------------------------------------------------------------------
+void safeReadInt(int * number_ptr, const char * prompt)
+{
+	while ((scanf("%d", number_ptr)) != ONE)
+	{
+		puts(prompt);
+		cleanBuffer();
+	}
+	cleanBuffer();
+}
+
+//----------------------------------------------------------------------------
+//	Function:		cleanBuffer()
+//  Title:			Clean the buffer
+//	Description:	This function will clean the buffer for the program
+//  Programmer:		Son Minh Tran
+//  Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit 
+//	Input:			None		
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		None
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 moved to AmortConsole.c
+//----------------------------------------------------------------------------
+void cleanBuffer()
+{
+	while (getchar() != '\n');
+}
+
+#ifndef _WIN32
+//----------------------------------------------------------------------------
+//	Function:		getche()
+//  Title:			Get character with echo
+//	Description:	This function will read one key without waiting for
+//					Enter and echo it, like getche() from <conio.h> does on
+//					Windows. When the input is not a terminal it reads the
+//					next character as it is
+//	Input:			one key
+//	Output:			the key is echoed
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		the character read, or EOF
+//	History Log:	10/17/2026 written for the portable build
+//----------------------------------------------------------------------------
+int getche(void)
+{
+	struct termios saved;
+	struct termios raw;
+	int ch = 0;
+	if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &saved) != ZERO)
+	{
+		return getchar();
+	}
+	raw = saved;
+	raw.c_lflag &= ~ICANON;
+	raw.c_cc[VMIN] = ONE;
+	raw.c_cc[VTIME] = ZERO;
+	tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+	ch = getchar();
+	tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+	return ch;
+}
+#endif
+
+//----------------------------------------------------------------------------
+//	Function:		clearScreen()
+//  Title:			Clear screen
+//	Description:	This function will clear the console, with "cls" on
+//					Windows and the ANSI escape sequence elsewhere
+//	Input:			None
+//	Output:			a clear console
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the portable build
+//----------------------------------------------------------------------------
+void clearScreen(void)
+{
+#ifdef _WIN32
+	system("cls");
+#else
+	fputs("\033[H\033[2J", stdout);
+	fflush(stdout);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		showFile()
+//  Title:			Show file
+//	Description:	This function will open a file the program wrote with
+//					its default viewer on Windows, and tell where it is
+//					everywhere else
+//	Input:			None
+//	Output:			the file in its viewer, or its name to the console
+//	Calls:			None
+//	Parameters:		filename	(const char*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the portable build
+//----------------------------------------------------------------------------
+void showFile(const char* filename)
+{
+#ifdef _WIN32
+	system(filename);
+#else
+	printf("\nThe table was written to %s\n", filename);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		printMenu()
+//  Title:			print menu
+//	Description:	This function will print out the menu option
+//  Programmer:		Son Minh Tran
+//  Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit 
+//	Input:			None		
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		None
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 moved to AmortConsole.c
+//----------------------------------------------------------------------------
+void printMenu() {
+	printf("Amortization!\n");
+	printf("Amortization Program written by Son Tran. ");
+	printf("Please select a Menu Option\n\n");
+	printf("\t1. Calculate (P)ayment Size\n");
+	printf("\t2. Calculate (L)oan Size\n");
+	printf("\t3. Calculate (N)umber of Payments\n");
+	printf("\t4. Calculate (I)nterest (APR)\n");
+	printf("\t5. (Q)uit\n\n");
+	printf("Enter a menu option: ");
+}
+
+//----------------------------------------------------------------------------
+//	Function:		printTable()
+//  Title:			print table
+//	Description:	This function will print the table out to a file
+//  Programmer:		Son Minh Tran
+//  Date:			03/04/2017
+//	Version:			1.0
+//	Environment:		HP Elitebook 8570P 
+//					Hardware: 8GB
+//							  Intel(R) Core(TM) i5-3320M 
+//					Software: OS: MS Windows 10 Professional 64-bit 
+//	Input:			None		
+//	Output:			print and export a file contain the table of APR, payment
+//	Calls:			generateSchedule()
+//					generateScheduleCents()
+//					writeTableHeader()
+//					writeTableRows()
+//					writeCentsRows()
+//					showFile()
+//	Parameters:		principal	(double)
+//					payment		(double)
+//					monthlyRate	(double)
+//					month		(int)
+//					arithmetic	(int) ARITHMETIC_DOUBLE or ARITHMETIC_CENTS
+//  Returns:		void
+//	History Log:	03/04/2017 Complete version 1.0
+//					10/17/2026 rows come from generateSchedule()
+//					10/17/2026 rows formatted by the buffered TableWriter
+//					10/17/2026 whole cents when ARITHMETIC_CENTS is chosen
+//					10/17/2026 moved to AmortConsole.c
+//					10/17/2026 table shown through showFile()
+//					10/17/2026 doubles when the cents table would overflow
+//					10/17/2026 arithmetic passed in by main()
+//----------------------------------------------------------------------------
+void printTable(double principal, double payment, double monthlyRate, int month,
+	int arithmetic) {
+	char ch = ' ';
+	char filename[FILENAME_MAX] = "AmTable.txt";
+	int returnValue = EXIT_SUCCESS;
+	ScheduleRow * rows = NULL;
+	CentsRow * centsRows = NULL;
+	int aprEighths = 0;
+	int count = 0;
+	TableWriter writer;
+	FILE * outFileHandle = NULL;
+	printf("\nDo you wish to print an Amortization Table(Y/N)? Y\b");
+	ch = getche();
+	if (ch == 'N' || ch == 'n')
+	{
+		return;
+	}
+	else {
+		outFileHandle = fopen(filename, "w");
+		//the same buffer holds whichever kind of row is generated
+		rows = malloc((month > ZERO ? month : ONE) *
+			(sizeof(ScheduleRow) > sizeof(CentsRow) ? sizeof(ScheduleRow) :
+			sizeof(CentsRow)));
+		if (outFileHandle == NULL || rows == NULL)
+		{
+			printf("Could not open file %s for output.\n"
+				"Press any key to Continue", filename);
+			returnValue = EXIT_FAILURE;
+		}
+		else {
+			returnValue = openTableWriter(&writer, outFileHandle);
+			if (returnValue == EXIT_SUCCESS)
+			{
+				writeTableHeader(&writer, principal, monthlyRate, month);
+				centsRows = (CentsRow*)rows;
+				count = ZERO;
+				if (arithmetic == ARITHMETIC_CENTS &&
+					toAprEighths(monthlyRate, &aprEighths))
+				{
+					count = generateScheduleCents(toCents(principal),
+						toCents(payment), aprEighths, month, centsRows);
+				}
+				if (count > ZERO)
+				{
+					writeCentsRows(&writer, centsRows, count);
+				}
+				else
+				{
+					month = generateSchedule(principal, payment, monthlyRate,
+						month, rows);
+					writeTableRows(&writer, rows, month);
+				}
+				returnValue = closeTableWriter(&writer);
+			}
+		}
+		free(rows);
+		if (outFileHandle != NULL)
+		{
+			fclose(outFileHandle);
+		}
+		showFile(filename);
+	}
+}
@@ -0,0 +1,21 @@
+#ifndef AMORTCONSOLE_H
+#define AMORTCONSOLE_H
+#include "Amort.h"
+#ifdef _WIN32
+#include <conio.h>
+#else
+int getche(void);
+#endif
+void safeReadDouble(double* number_ptr, const char * prompt);
+void safeReadInt(int* number_ptr, const char * prompt);
+void cleanBuffer();
+void clearScreen(void);
+void showFile(const char* filename);
+void printMenu();
+void printTable(double principal, double payment, double monthlyRate, int month,
+	int arithmetic);
+double readApr();
+double readPrincipal();
+double readPayment();
+int readMonth();
+#endif
@@ -0,0 +1,104 @@
+#include "AmortGrowth.h"
+#include <stdlib.h>
+#include <math.h>
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define HALF 0.5
+#define YEARLY_INTEREST_RATE 1200
+
+//rates[k] is the monthly rate of an APR of k eighths of a point and
+//growth[k][n] is (1 + rates[k])^n, exactly what pow() returns for them
+static double rates[GROWTH_RATES];
+static double growth[GROWTH_RATES][GROWTH_MAX_MONTHS + ONE];
+static int growthReady = FALSE;
+
+//----------------------------------------------------------------------------
+//	Function:		initGrowthTable()
+//  Title:			Initialize growth table
+//	Description:	This function will fill the table of (1 + r)^n for every
+//					APR roundToOneEighth() can give from 0 to GROWTH_MAX_APR
+//					and every term readMonth() accepts. The values come from
+//					the same pow() call the calculations make, so using the
+//					table changes no result. It has to run before any
+//					thread starts calculating
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		EXIT_SUCCESS
+//	History Log:	10/17/2026 written for the growth table
+//----------------------------------------------------------------------------
+int initGrowthTable(void)
+{
+	int k = 0;
+	int n = 0;
+	if (growthReady)
+	{
+		return EXIT_SUCCESS;
+	}
+	for (k = 0; k < GROWTH_RATES; k++)
+	{
+		rates[k] = ((double)k / GROWTH_STEPS_PER_POINT) / YEARLY_INTEREST_RATE;
+		for (n = 0; n <= GROWTH_MAX_MONTHS; n++)
+		{
+			growth[k][n] = pow((ONE + rates[k]), n);
+		}
+	}
+	growthReady = TRUE;
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		findGrowthRow()
+//  Title:			Find growth row
+//	Description:	This function will find the table row of a monthly rate,
+//					which only exists when the rate is exactly an APR eighth
+//					divided by 1200 and the table has been built
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		monthlyRate	(double)
+//  Returns:		the row, (1 + monthlyRate)^n at index n, or NULL
+//	History Log:	10/17/2026 written for the growth table
+//----------------------------------------------------------------------------
+const double* findGrowthRow(double monthlyRate)
+{
+	double position = monthlyRate * YEARLY_INTEREST_RATE *
+		GROWTH_STEPS_PER_POINT + HALF;
+	int k = 0;
+	if (!growthReady || !(position >= ZERO && position < GROWTH_RATES))
+	{
+		return NULL;
+	}
+	k = (int)position;
+	return rates[k] == monthlyRate ? growth[k] : NULL;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getGrowthFactor()
+//  Title:			Get growth factor
+//	Description:	This function will give (1 + monthlyRate)^months from
+//					the table when it is there and from pow() when not
+//	Input:			None
+//	Output:			None
+//	Calls:			findGrowthRow()
+//	Parameters:		monthlyRate	(double)
+//					months		(int)
+//  Returns:		the growth factor
+//	History Log:	10/17/2026 written for the growth table
+//----------------------------------------------------------------------------
+double getGrowthFactor(double monthlyRate, int months)
+{
+	const double* row = NULL;
+	if (months >= ZERO && months <= GROWTH_MAX_MONTHS)
+	{
+		row = findGrowthRow(monthlyRate);
+		if (row != NULL)
+		{
+			return row[months];
+		}
+	}
+	return pow((ONE + monthlyRate), months);
+}
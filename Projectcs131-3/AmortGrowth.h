@@ -0,0 +1,10 @@
+#ifndef AMORTGROWTH_H
+#define AMORTGROWTH_H
+#define GROWTH_MAX_APR 30
+#define GROWTH_MAX_MONTHS 360
+#define GROWTH_STEPS_PER_POINT 8
+#define GROWTH_RATES (GROWTH_MAX_APR * GROWTH_STEPS_PER_POINT + 1)
+int initGrowthTable(void);
+const double* findGrowthRow(double monthlyRate);
+double getGrowthFactor(double monthlyRate, int months);
+#endif
@@ -0,0 +1,127 @@
+#include "AmortMap.h"
+#include <stdlib.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#define ZERO 0
+
+//----------------------------------------------------------------------------
+//	Function:		mapFile()
+//  Title:			Map file
+//	Description:	This function will map a whole file read-only so it can
+//					be read straight from memory without copying. An empty
+//					file maps to data NULL and size 0
+//	Input:			the file
+//	Output:			None
+//	Calls:			None
+//	Parameters:		map		(MappedFile*)
+//					name	(const char*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the file cannot be
+//					opened or mapped
+//	History Log:	10/17/2026 written for binary schedule files
+//----------------------------------------------------------------------------
+int mapFile(MappedFile* map, const char* name)
+{
+#ifdef _WIN32
+	LARGE_INTEGER size;
+	map->data = NULL;
+	map->size = 0;
+	map->mapping = NULL;
+	map->file = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (map->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(map->file, &size))
+	{
+		unmapFile(map);
+		return EXIT_FAILURE;
+	}
+	map->size = (size_t)size.QuadPart;
+	if (map->size == ZERO)
+	{
+		return EXIT_SUCCESS;
+	}
+	map->mapping = CreateFileMappingA(map->file, NULL, PAGE_READONLY, 0, 0,
+		NULL);
+	if (map->mapping != NULL)
+	{
+		map->data = MapViewOfFile(map->mapping, FILE_MAP_READ, 0, 0, 0);
+	}
+	if (map->data == NULL)
+	{
+		unmapFile(map);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+#else
+	struct stat status;
+	void* data = NULL;
+	map->data = NULL;
+	map->size = 0;
+	map->descriptor = open(name, O_RDONLY);
+	if (map->descriptor < ZERO || fstat(map->descriptor, &status) != ZERO)
+	{
+		unmapFile(map);
+		return EXIT_FAILURE;
+	}
+	map->size = (size_t)status.st_size;
+	if (map->size == ZERO)
+	{
+		return EXIT_SUCCESS;
+	}
+	data = mmap(NULL, map->size, PROT_READ, MAP_PRIVATE, map->descriptor, 0);
+	if (data == MAP_FAILED)
+	{
+		map->size = 0;
+		unmapFile(map);
+		return EXIT_FAILURE;
+	}
+	madvise(data, map->size, MADV_SEQUENTIAL);
+	map->data = data;
+	return EXIT_SUCCESS;
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		unmapFile()
+//  Title:			Unmap file
+//	Description:	This function will release a mapping made by mapFile()
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		map	(MappedFile*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for binary schedule files
+//----------------------------------------------------------------------------
+void unmapFile(MappedFile* map)
+{
+#ifdef _WIN32
+	if (map->data != NULL)
+	{
+		UnmapViewOfFile(map->data);
+	}
+	if (map->mapping != NULL)
+	{
+		CloseHandle(map->mapping);
+	}
+	if (map->file != INVALID_HANDLE_VALUE && map->file != NULL)
+	{
+		CloseHandle(map->file);
+	}
+	map->mapping = NULL;
+	map->file = NULL;
+#else
+	if (map->data != NULL)
+	{
+		munmap((void*)map->data, map->size);
+	}
+	if (map->descriptor >= ZERO)
+	{
+		close(map->descriptor);
+	}
+	map->descriptor = -1;
+#endif
+	map->data = NULL;
+	map->size = 0;
+}
@@ -0,0 +1,22 @@
+#ifndef AMORTMAP_H
+#define AMORTMAP_H
+#include <stddef.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+//----------------------------------------------------------------------------
+// MappedFile: a whole file mapped read-only into memory
+//----------------------------------------------------------------------------
+typedef struct MappedFile {
+	const char* data;
+	size_t size;
+#ifdef _WIN32
+	HANDLE file;
+	HANDLE mapping;
+#else
+	int descriptor;
+#endif
+} MappedFile;
+int mapFile(MappedFile* map, const char* name);
+void unmapFile(MappedFile* map);
+#endif
@@ -0,0 +1,356 @@
+#include "AmortParallel.h"
+#include "AmortThread.h"
+#include <stdlib.h>
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+
+//----------------------------------------------------------------------------
+// WorkRange: the items [next, end) a worker still owns. The owner takes
+//		grain items from the front, idle workers steal half from the back
+//----------------------------------------------------------------------------
+typedef struct WorkRange {
+	AmortMutex lock;
+	size_t next;
+	size_t end;
+} WorkRange;
+
+//----------------------------------------------------------------------------
+// ParallelJob: everything the workers of one parallelFor() share
+//----------------------------------------------------------------------------
+typedef struct ParallelJob {
+	WorkRange* ranges;
+	int threadCount;
+	size_t grain;
+	ParallelBody body;
+	void* context;
+} ParallelJob;
+
+//----------------------------------------------------------------------------
+// WorkerPool: the threads parallelFor() starts once and keeps parked on
+//		wake between calls. Pool thread n is worker n of every job; the
+//		caller is worker 0. submit lets one job run at a time, lock guards
+//		job, generation and running, and job is NULL between jobs so a
+//		thread started between two jobs never sees the old one
+//----------------------------------------------------------------------------
+typedef struct WorkerPool {
+	AmortMutex submit;
+	AmortMutex lock;
+	AmortCondition wake;
+	AmortCondition done;
+	ParallelJob* job;
+	long generation;
+	int running;
+	int threadCount;
+	AmortThread threads[MAX_THREADS];
+	int workers[MAX_THREADS];
+	WorkRange ranges[MAX_THREADS];
+} WorkerPool;
+
+static WorkerPool pool;
+static AmortOnce poolOnce = AMORT_ONCE_INIT;
+
+//----------------------------------------------------------------------------
+//	Function:		getThreadCount()
+//  Title:			Get thread count
+//	Description:	This function will turn a requested thread count into
+//					the number of threads to use, 0 meaning every processor
+//	Input:			None
+//	Output:			None
+//	Calls:			getCpuCount()
+//	Parameters:		requested	(int)
+//  Returns:		thread count from 1 to MAX_THREADS
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+int getThreadCount(int requested)
+{
+	if (requested <= ZERO)
+	{
+		requested = getCpuCount();
+	}
+	return requested > MAX_THREADS ? MAX_THREADS : requested;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		takeOwnWork()
+//  Title:			Take own work
+//	Description:	This function will take the next grain items from the
+//					front of a worker's own range
+//	Input:			None
+//	Output:			None
+//	Calls:			lockMutex()
+//					unlockMutex()
+//	Parameters:		range	(WorkRange*)
+//					grain	(size_t)
+//					begin	(size_t*)
+//					end		(size_t*)
+//  Returns:		TRUE when items were taken
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+static int takeOwnWork(WorkRange* range, size_t grain, size_t* begin,
+	size_t* end)
+{
+	int found = FALSE;
+	lockMutex(&range->lock);
+	if (range->next < range->end)
+	{
+		*begin = range->next;
+		*end = range->end - range->next > grain ?
+			range->next + grain : range->end;
+		range->next = *end;
+		found = TRUE;
+	}
+	unlockMutex(&range->lock);
+	return found;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		stealWork()
+//  Title:			Steal work
+//	Description:	This function will look at the other workers in turn
+//					and move the back half of the first non-empty range
+//					into the thief's own range
+//	Input:			None
+//	Output:			None
+//	Calls:			lockMutex()
+//					unlockMutex()
+//	Parameters:		job		(ParallelJob*)
+//					worker	(int)
+//  Returns:		TRUE when something was stolen, FALSE when every range
+//					is empty
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+static int stealWork(ParallelJob* job, int worker)
+{
+	WorkRange* victim = NULL;
+	WorkRange* own = &job->ranges[worker];
+	size_t begin = 0;
+	size_t end = 0;
+	int offset = 0;
+
+	for (offset = ONE; offset < job->threadCount; offset++)
+	{
+		victim = &job->ranges[(worker + offset) % job->threadCount];
+		lockMutex(&victim->lock);
+		if (victim->next < victim->end)
+		{
+			end = victim->end;
+			if (end - victim->next <= job->grain)
+			{
+				begin = victim->next;
+			}
+			else
+			{
+				begin = victim->next + (end - victim->next) / 2;
+			}
+			victim->end = begin;
+		}
+		unlockMutex(&victim->lock);
+		if (begin < end)
+		{
+			lockMutex(&own->lock);
+			own->next = begin;
+			own->end = end;
+			unlockMutex(&own->lock);
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runWorker()
+//  Title:			Run worker
+//	Description:	This function will work through a worker's own range
+//					and then keep stealing until nothing is left anywhere
+//	Input:			None
+//	Output:			None
+//	Calls:			takeOwnWork()
+//					stealWork()
+//					the parallel body
+//	Parameters:		job		(ParallelJob*)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 takes the job and worker number directly
+//----------------------------------------------------------------------------
+static void runWorker(ParallelJob* job, int worker)
+{
+	size_t begin = 0;
+	size_t end = 0;
+
+	do
+	{
+		while (takeOwnWork(&job->ranges[worker], job->grain, &begin, &end))
+		{
+			job->body(job->context, begin, end, worker);
+		}
+	} while (stealWork(job, worker));
+}
+
+//----------------------------------------------------------------------------
+//	Function:		initPool()
+//  Title:			Init pool
+//	Description:	This function will set up the locks and conditions of
+//					the worker pool, before its first thread starts
+//	Input:			None
+//	Output:			None
+//	Calls:			initMutex()
+//					initCondition()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the parked worker pool
+//----------------------------------------------------------------------------
+static void initPool(void)
+{
+	int i = 0;
+	initMutex(&pool.submit);
+	initMutex(&pool.lock);
+	initCondition(&pool.wake);
+	initCondition(&pool.done);
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		initMutex(&pool.ranges[i].lock);
+		pool.workers[i] = i;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		poolWorker()
+//  Title:			Pool worker
+//	Description:	This function will park a pool thread until a job is
+//					posted, run its share when its worker number is one the
+//					job uses, tell the caller when the last share is done
+//					and park again, for the life of the process
+//	Input:			None
+//	Output:			None
+//	Calls:			lockMutex()
+//					waitCondition()
+//					runWorker()
+//					wakeCondition()
+//					unlockMutex()
+//	Parameters:		argument	(void*) the worker number
+//  Returns:		void
+//	History Log:	10/17/2026 written for the parked worker pool
+//----------------------------------------------------------------------------
+static void poolWorker(void* argument)
+{
+	int worker = *(int*)argument;
+	ParallelJob* job = NULL;
+	long seen = 0;
+
+	lockMutex(&pool.lock);
+	for (;;)
+	{
+		while (pool.job == NULL || pool.generation == seen)
+		{
+			waitCondition(&pool.wake, &pool.lock);
+		}
+		seen = pool.generation;
+		job = pool.job;
+		if (worker < job->threadCount)
+		{
+			unlockMutex(&pool.lock);
+			runWorker(job, worker);
+			lockMutex(&pool.lock);
+			pool.running--;
+			if (pool.running == ZERO)
+			{
+				wakeCondition(&pool.done);
+			}
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		parallelFor()
+//  Title:			Parallel for
+//	Description:	This function will call body over items [0, count)
+//					split between threadCount workers. Every worker starts
+//					with an equal share and steals from the others when it
+//					runs out, so uneven items (an APR solve next to a
+//					payment) still keep every core busy. The calling thread
+//					is worker 0; the others are pool threads started the
+//					first time that many are asked for and parked between
+//					calls, so a call costs a wake rather than a thread
+//					start. Calls from several threads take turns; a body
+//					must not call parallelFor() itself. The function
+//					returns when all items are done
+//	Input:			None
+//	Output:			None
+//	Calls:			getThreadCount()
+//					runOnce()
+//					initPool()
+//					createThread()
+//					poolWorker()
+//					runWorker()
+//					lockMutex()
+//					unlockMutex()
+//					wakeCondition()
+//					waitCondition()
+//	Parameters:		count		(size_t)
+//					grain		(size_t)
+//					threadCount	(int)
+//					body		(ParallelBody)
+//					context		(void*)
+//  Returns:		EXIT_SUCCESS
+//	History Log:	10/17/2026 workers parked in a pool between calls
+//					instead of started and joined by every call
+//----------------------------------------------------------------------------
+int parallelFor(size_t count, size_t grain, int threadCount,
+	ParallelBody body, void* context)
+{
+	ParallelJob job;
+	int i = 0;
+
+	threadCount = getThreadCount(threadCount);
+	if ((size_t)threadCount > count)
+	{
+		threadCount = count > ZERO ? (int)count : ONE;
+	}
+	if (threadCount == ONE)
+	{
+		if (count > ZERO)
+		{
+			body(context, 0, count, 0);
+		}
+		return EXIT_SUCCESS;
+	}
+	runOnce(&poolOnce, initPool);
+	lockMutex(&pool.submit);
+	job.ranges = pool.ranges;
+	job.threadCount = threadCount;
+	job.grain = grain > ZERO ? grain : ONE;
+	job.body = body;
+	job.context = context;
+	for (i = 0; i < threadCount; i++)
+	{
+		job.ranges[i].next = count / threadCount * i;
+		job.ranges[i].end = i == threadCount - ONE ?
+			count : count / threadCount * (i + ONE);
+	}
+	//a worker that fails to start leaves its range to be stolen
+	while (pool.threadCount < threadCount - ONE &&
+		createThread(&pool.threads[pool.threadCount + ONE], poolWorker,
+		&pool.workers[pool.threadCount + ONE]) == EXIT_SUCCESS)
+	{
+		pool.threadCount++;
+	}
+	lockMutex(&pool.lock);
+	pool.job = &job;
+	pool.running = pool.threadCount < threadCount - ONE ?
+		pool.threadCount : threadCount - ONE;
+	pool.generation++;
+	wakeCondition(&pool.wake);
+	unlockMutex(&pool.lock);
+	runWorker(&job, 0);
+	lockMutex(&pool.lock);
+	while (pool.running > ZERO)
+	{
+		waitCondition(&pool.done, &pool.lock);
+	}
+	pool.job = NULL;
+	unlockMutex(&pool.lock);
+	unlockMutex(&pool.submit);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,15 @@
+#ifndef AMORTPARALLEL_H
+#define AMORTPARALLEL_H
+#include <stddef.h>
+#define MAX_THREADS 256
+//----------------------------------------------------------------------------
+// ParallelBody: the work for items [begin, end) done by thread number
+//		worker (0 .. threadCount - 1); each worker number is only ever used
+//		by one thread at a time so it can index per-thread state
+//----------------------------------------------------------------------------
+typedef void (*ParallelBody)(void* context, size_t begin, size_t end,
+	int worker);
+int getThreadCount(int requested);
+int parallelFor(size_t count, size_t grain, int threadCount,
+	ParallelBody body, void* context);
+#endif
@@ -0,0 +1,658 @@
+#include "AmortPortfolio.h"
+#include "AmortBatch.h"
+#include "AmortReader.h"
+#include "AmortParallel.h"
+#include "AmortSchedule.h"
+#include <string.h>
+#define ONE 1
+#define ZERO 0
+#define HUNDRED 100
+#define LABEL_MAX 32
+
+//----------------------------------------------------------------------------
+// PortfolioPart: what one worker of aggregatePortfolio() has added up,
+// kept apart from the other workers' until the end
+//----------------------------------------------------------------------------
+typedef struct PortfolioPart {
+	CentsRow* flows;
+	long long* bucketLoans;
+	long long loans;
+	long long skipped;
+} PortfolioPart;
+//----------------------------------------------------------------------------
+// PortfolioJob: what aggregatePortfolio() hands to its workers
+//----------------------------------------------------------------------------
+typedef struct PortfolioJob {
+	const AmortResult* loans;
+	const PortfolioFlows* shape;
+	PortfolioPart* parts;
+} PortfolioJob;
+//----------------------------------------------------------------------------
+// CalculateJob: the chunk runPortfolioFile() hands to its workers, a loan
+// for every request
+//----------------------------------------------------------------------------
+typedef struct CalculateJob {
+	const AmortRequest* requests;
+	AmortResult* loans;
+} CalculateJob;
+
+//----------------------------------------------------------------------------
+//	Function:		initPortfolioFlows()
+//  Title:			Initialize portfolio flows
+//	Description:	This function will set up empty monthly totals for one
+//					way of bucketing the loans
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		flows		(PortfolioFlows*)
+//					bucketing	(int) PORTFOLIO_TOTAL, PORTFOLIO_BY_APR or
+//								PORTFOLIO_BY_TERM
+//					bucketWidth	(int) APR points or months per bucket
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the bucketing is
+//					unknown, gives more than PORTFOLIO_MAX_BUCKETS buckets
+//					or memory runs out
+//	History Log:	10/17/2026 written for portfolio aggregation
+//----------------------------------------------------------------------------
+int initPortfolioFlows(PortfolioFlows* flows, int bucketing, int bucketWidth)
+{
+	int month = 0;
+	int i = 0;
+
+	memset(flows, ZERO, sizeof(*flows));
+	if (bucketing == PORTFOLIO_TOTAL)
+	{
+		bucketWidth = ONE;
+		flows->bucketCount = ONE;
+	}
+	else if (bucketWidth <= ZERO)
+	{
+		return EXIT_FAILURE;
+	}
+	else if (bucketing == PORTFOLIO_BY_APR)
+	{
+		flows->bucketCount = PORTFOLIO_APR_LIMIT / bucketWidth + ONE;
+	}
+	else if (bucketing == PORTFOLIO_BY_TERM)
+	{
+		flows->bucketCount = (PORTFOLIO_MONTHS + bucketWidth - ONE) /
+			bucketWidth;
+	}
+	else
+	{
+		return EXIT_FAILURE;
+	}
+	if (flows->bucketCount > PORTFOLIO_MAX_BUCKETS)
+	{
+		return EXIT_FAILURE;
+	}
+	flows->bucketing = bucketing;
+	flows->bucketWidth = bucketWidth;
+	flows->months = PORTFOLIO_MONTHS;
+	flows->flows = calloc((size_t)flows->bucketCount * PORTFOLIO_MONTHS,
+		sizeof(CentsRow));
+	flows->total = calloc(PORTFOLIO_MONTHS, sizeof(CentsRow));
+	flows->bucketLoans = calloc(flows->bucketCount, sizeof(long long));
+	if (flows->flows == NULL || flows->total == NULL ||
+		flows->bucketLoans == NULL)
+	{
+		freePortfolioFlows(flows);
+		return EXIT_FAILURE;
+	}
+	for (month = 0; month < PORTFOLIO_MONTHS; month++)
+	{
+		flows->total[month].month = month + ONE;
+		for (i = 0; i < flows->bucketCount; i++)
+		{
+			flows->flows[i * PORTFOLIO_MONTHS + month].month = month + ONE;
+		}
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		freePortfolioFlows()
+//  Title:			Free portfolio flows
+//	Description:	This function will release what initPortfolioFlows()
+//					allocated
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		flows	(PortfolioFlows*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for portfolio aggregation
+//----------------------------------------------------------------------------
+void freePortfolioFlows(PortfolioFlows* flows)
+{
+	free(flows->flows);
+	free(flows->total);
+	free(flows->bucketLoans);
+	flows->flows = NULL;
+	flows->total = NULL;
+	flows->bucketLoans = NULL;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		growPortfolioMonths()
+//  Title:			Grow portfolio months
+//	Description:	This function will lengthen every bucket's rows to
+//					months, moving each bucket to its new place from the
+//					last one down so no rows are written over, and giving
+//					the new months zero flows
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		flows	(PortfolioFlows*)
+//					months	(int) more than flows->months
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when memory runs out, which
+//					leaves flows as it was
+//	History Log:	10/17/2026 written for portfolio aggregation
+//----------------------------------------------------------------------------
+static int growPortfolioMonths(PortfolioFlows* flows, int months)
+{
+	CentsRow* grown = NULL;
+	CentsRow* total = NULL;
+	int month = 0;
+	int i = 0;
+
+	grown = realloc(flows->flows, (size_t)flows->bucketCount * months *
+		sizeof(CentsRow));
+	if (grown == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+	flows->flows = grown;
+	total = realloc(flows->total, (size_t)months * sizeof(CentsRow));
+	if (total == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+	flows->total = total;
+	for (i = flows->bucketCount - ONE; i >= 0; i--)
+	{
+		memmove(grown + (size_t)i * months, grown + (size_t)i * flows->months,
+			(size_t)flows->months * sizeof(CentsRow));
+		memset(grown + (size_t)i * months + flows->months, ZERO,
+			(size_t)(months - flows->months) * sizeof(CentsRow));
+		for (month = flows->months; month < months; month++)
+		{
+			grown[(size_t)i * months + month].month = month + ONE;
+		}
+	}
+	memset(total + flows->months, ZERO,
+		(size_t)(months - flows->months) * sizeof(CentsRow));
+	for (month = flows->months; month < months; month++)
+	{
+		total[month].month = month + ONE;
+	}
+	flows->months = months;
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getPortfolioBucket()
+//  Title:			Get portfolio bucket
+//	Description:	This function will find the bucket a loan is added to
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		flows	(const PortfolioFlows*)
+//					loan	(const AmortResult*)
+//  Returns:		the bucket, from 0 to flows->bucketCount - 1
+//	History Log:	10/17/2026 written for portfolio aggregation
+//----------------------------------------------------------------------------
+int getPortfolioBucket(const PortfolioFlows* flows, const AmortResult* loan)
+{
+	double band = 0.0;
+	int bucket = 0;
+
+	if (flows->bucketing == PORTFOLIO_BY_APR)
+	{
+		band = loan->apr / flows->bucketWidth;
+		bucket = band < flows->bucketCount ? (int)band :
+			flows->bucketCount - ONE;
+	}
+	else if (flows->bucketing == PORTFOLIO_BY_TERM)
+	{
+		bucket = (loan->months - ONE) / flows->bucketWidth;
+	}
+	if (bucket < ZERO)
+	{
+		return ZERO;
+	}
+	return bucket < flows->bucketCount ? bucket : flows->bucketCount - ONE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		addLoanFlows()
+//  Title:			Add loan flows
+//	Description:	This function will walk one loan's table a row at a
+//					time and add every month, rounded to the cent, to its
+//					bucket, which aggregatePortfolio() has made long enough
+//					for every month of it
+//	Input:			None
+//	Output:			None
+//	Calls:			getPortfolioBucket()
+//					initScheduleCursor()
+//					nextScheduleRow()
+//					toCents()
+//	Parameters:		shape	(const PortfolioFlows*) the bucketing
+//					part	(PortfolioPart*) the worker's totals
+//					loan	(const AmortResult*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for portfolio aggregation
+//					10/17/2026 rows as long as the longest loan
+//----------------------------------------------------------------------------
+static void addLoanFlows(const PortfolioFlows* shape, PortfolioPart* part,
+	const AmortResult* loan)
+{
+	ScheduleCursor cursor;
+	ScheduleRow row;
+	CentsRow* flows = NULL;
+	int bucket = 0;
+
+	if (loan->status != AMORT_OK)
+	{
+		part->skipped++;
+		return;
+	}
+	bucket = getPortfolioBucket(shape, loan);
+	flows = part->flows + (size_t)bucket * shape->months;
+	part->bucketLoans[bucket]++;
+	part->loans++;
+	initScheduleCursor(&cursor, loan->principal, loan->payment,
+		loan->monthlyRate, loan->months);
+	while (cursor.row < shape->months && nextScheduleRow(&cursor, &row))
+	{
+		flows[row.month - ONE].payment += toCents(row.payment);
+		flows[row.month - ONE].principalPaid += toCents(row.principalPaid);
+		flows[row.month - ONE].interestPaid += toCents(row.interestPaid);
+		flows[row.month - ONE].balance += toCents(row.balance);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		aggregateSlice()
+//  Title:			Aggregate slice
+//	Description:	This function will add loans [begin, end) to the totals
+//					of one worker of aggregatePortfolio()
+//	Input:			None
+//	Output:			None
+//	Calls:			addLoanFlows()
+//	Parameters:		context	(void*)
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for portfolio aggregation
+//----------------------------------------------------------------------------
+static void aggregateSlice(void* context, size_t begin, size_t end,
+	int worker)
+{
+	PortfolioJob* job = (PortfolioJob*)context;
+	size_t i = 0;
+	for (i = begin; i < end; i++)
+	{
+		addLoanFlows(job->shape, &job->parts[worker], &job->loans[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		aggregatePortfolio()
+//  Title:			Aggregate portfolio
+//	Description:	This function will add the monthly cash flows of every
+//					loan to flows, on threadCount threads (0 for every
+//					processor). Each worker adds into its own totals and
+//					they are added together at the end, so no thread waits
+//					on another. The totals are whole cents, so they come
+//					out the same whichever thread added which loan. It can
+//					be called again with more loans. A loan longer than the
+//					rows so far, such as a long term worked out from a
+//					payment, lengthens every bucket's rows first
+//	Input:			None
+//	Output:			None
+//	Calls:			growPortfolioMonths()
+//					getThreadCount()
+//					parallelFor()
+//					aggregateSlice()
+//	Parameters:		loans		(const AmortResult*) loans amortCalculate()
+//								finished; failed ones are counted as skipped
+//					count		(size_t)
+//					threadCount	(int)
+//					flows		(PortfolioFlows*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when memory runs out
+//	History Log:	10/17/2026 written for portfolio aggregation
+//					10/17/2026 rows grown to the longest loan
+//----------------------------------------------------------------------------
+int aggregatePortfolio(const AmortResult* loans, size_t count,
+	int threadCount, PortfolioFlows* flows)
+{
+	PortfolioJob job;
+	size_t size = 0;
+	size_t i = 0;
+	int longest = flows->months;
+	int worker = 0;
+	int returnValue = EXIT_SUCCESS;
+
+	for (i = 0; i < count; i++)
+	{
+		if (loans[i].status == AMORT_OK && loans[i].months > longest)
+		{
+			longest = loans[i].months;
+		}
+	}
+	if (longest > flows->months &&
+		growPortfolioMonths(flows, longest) != EXIT_SUCCESS)
+	{
+		return EXIT_FAILURE;
+	}
+	size = (size_t)flows->bucketCount * flows->months;
+	threadCount = getThreadCount(threadCount);
+	job.loans = loans;
+	job.shape = flows;
+	job.parts = calloc(threadCount, sizeof(PortfolioPart));
+	if (job.parts == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+	for (worker = 0; worker < threadCount; worker++)
+	{
+		job.parts[worker].flows = calloc(size, sizeof(CentsRow));
+		job.parts[worker].bucketLoans = calloc(flows->bucketCount,
+			sizeof(long long));
+		if (job.parts[worker].flows == NULL ||
+			job.parts[worker].bucketLoans == NULL)
+		{
+			returnValue = EXIT_FAILURE;
+		}
+	}
+	if (returnValue == EXIT_SUCCESS && parallelFor(count, PORTFOLIO_GRAIN,
+		threadCount, aggregateSlice, &job) != EXIT_SUCCESS)
+	{
+		returnValue = EXIT_FAILURE;
+	}
+	for (worker = 0; worker < threadCount; worker++)
+	{
+		if (returnValue == EXIT_SUCCESS)
+		{
+			//the reduction
+			for (i = 0; i < size; i++)
+			{
+				flows->flows[i].payment += job.parts[worker].flows[i].payment;
+				flows->flows[i].principalPaid +=
+					job.parts[worker].flows[i].principalPaid;
+				flows->flows[i].interestPaid +=
+					job.parts[worker].flows[i].interestPaid;
+				flows->flows[i].balance += job.parts[worker].flows[i].balance;
+			}
+			for (i = 0; i < (size_t)flows->bucketCount; i++)
+			{
+				flows->bucketLoans[i] += job.parts[worker].bucketLoans[i];
+			}
+			flows->loans += job.parts[worker].loans;
+			flows->skipped += job.parts[worker].skipped;
+		}
+		free(job.parts[worker].flows);
+		free(job.parts[worker].bucketLoans);
+	}
+	free(job.parts);
+	if (returnValue == EXIT_SUCCESS)
+	{
+		memset(flows->total, ZERO, flows->months * sizeof(CentsRow));
+		for (i = 0; i < size; i++)
+		{
+			flows->total[i % flows->months].month =
+				(int)(i % flows->months) + ONE;
+			flows->total[i % flows->months].payment +=
+				flows->flows[i].payment;
+			flows->total[i % flows->months].principalPaid +=
+				flows->flows[i].principalPaid;
+			flows->total[i % flows->months].interestPaid +=
+				flows->flows[i].interestPaid;
+			flows->total[i % flows->months].balance +=
+				flows->flows[i].balance;
+		}
+	}
+	return returnValue;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeFlowRows()
+//  Title:			Write flow rows
+//	Description:	This function will write the months of one bucket as
+//					"bucket,month,payment,principal,interest,balance" lines,
+//					stopping after the last month anything is paid
+//	Input:			None
+//	Output:			the lines
+//	Calls:			None
+//	Parameters:		file	(FILE*)
+//					label	(const char*)
+//					rows	(const CentsRow*)
+//					months	(int) rows there are
+//  Returns:		void
+//	History Log:	10/17/2026 written for portfolio aggregation
+//					10/17/2026 as many rows as the portfolio has
+//----------------------------------------------------------------------------
+static void writeFlowRows(FILE* file, const char* label, const CentsRow* rows,
+	int months)
+{
+	int last = months;
+	int i = 0;
+	while (last > ZERO && rows[last - ONE].payment == ZERO)
+	{
+		last--;
+	}
+	for (i = 0; i < last; i++)
+	{
+		fprintf(file, "%s,%d,%lld.%02lld,%lld.%02lld,%lld.%02lld,"
+			"%lld.%02lld\n", label, rows[i].month,
+			rows[i].payment / HUNDRED, rows[i].payment % HUNDRED,
+			rows[i].principalPaid / HUNDRED, rows[i].principalPaid % HUNDRED,
+			rows[i].interestPaid / HUNDRED, rows[i].interestPaid % HUNDRED,
+			rows[i].balance / HUNDRED, rows[i].balance % HUNDRED);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writePortfolioFlows()
+//  Title:			Write portfolio flows
+//	Description:	This function will write the portfolio's monthly totals
+//					as CSV: the "total" rows, then the rows of every bucket
+//					that has loans, labelled "APR 4-5", "APR 30+",
+//					"months 1-60" and so on; the last term bucket is
+//					"months 301+" once it holds terms past PORTFOLIO_MONTHS
+//	Input:			None
+//	Output:			the CSV
+//	Calls:			writeFlowRows()
+//	Parameters:		file	(FILE*)
+//					flows	(const PortfolioFlows*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the file cannot be
+//					written
+//	History Log:	10/17/2026 written for portfolio aggregation
+//					10/17/2026 rows past PORTFOLIO_MONTHS
+//----------------------------------------------------------------------------
+int writePortfolioFlows(FILE* file, const PortfolioFlows* flows)
+{
+	char label[LABEL_MAX];
+	int low = 0;
+	int i = 0;
+
+	fprintf(file, "bucket,month,payment,principal,interest,balance\n");
+	writeFlowRows(file, "total", flows->total, flows->months);
+	for (i = 0; i < flows->bucketCount && flows->bucketing !=
+		PORTFOLIO_TOTAL; i++)
+	{
+		if (flows->bucketLoans[i] == ZERO)
+		{
+			continue;
+		}
+		low = i * flows->bucketWidth;
+		if (flows->bucketing == PORTFOLIO_BY_TERM &&
+			i == flows->bucketCount - ONE && flows->months > PORTFOLIO_MONTHS)
+		{
+			sprintf(label, "months %d+", low + ONE);
+		}
+		else if (flows->bucketing == PORTFOLIO_BY_TERM)
+		{
+			sprintf(label, "months %d-%d", low + ONE,
+				low + flows->bucketWidth);
+		}
+		else if (i == flows->bucketCount - ONE)
+		{
+			sprintf(label, "APR %d+", low);
+		}
+		else
+		{
+			sprintf(label, "APR %d-%d", low, low + flows->bucketWidth);
+		}
+		writeFlowRows(file, label, flows->flows + (size_t)i * flows->months,
+			flows->months);
+	}
+	return ferror(file) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		calculateSlice()
+//  Title:			Calculate slice
+//	Description:	This function will calculate requests [begin, end) of a
+//					chunk for one worker of runPortfolioFile(), each loan at
+//					the index of its request
+//	Input:			None
+//	Output:			None
+//	Calls:			amortCalculate()
+//	Parameters:		context	(void*)
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written so the portfolio calculates its loans
+//					on every thread
+//----------------------------------------------------------------------------
+static void calculateSlice(void* context, size_t begin, size_t end,
+	int worker)
+{
+	CalculateJob* job = (CalculateJob*)context;
+	size_t i = 0;
+	(void)worker;
+	for (i = begin; i < end; i++)
+	{
+		amortCalculate(&job->requests[i], &job->loans[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runPortfolioFile()
+//  Title:			Run portfolio file
+//	Description:	This function will read a batch file BATCH_CHUNK records
+//					at a time, calculate each chunk's loans on threadCount
+//					threads like runBatchFile() and write the portfolio's
+//					monthly cash flows instead of one line per loan. Bad
+//					lines are reported with their line number and left out
+//	Input:			the batch file
+//	Output:			the cash flow file, errors to stderr
+//	Calls:			initPortfolioFlows()
+//					openLoanReader()
+//					readLoanLine()
+//					getLoanRequest()
+//					amortStatusText()
+//					parallelFor()
+//					calculateSlice()
+//					aggregatePortfolio()
+//					writePortfolioFlows()
+//					freePortfolioFlows()
+//					closeLoanReader()
+//	Parameters:		inName		(const char*)
+//					outName		(const char*)
+//					bucketing	(int)
+//					bucketWidth	(int)
+//					threadCount	(int)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when a file or the
+//					bucketing cannot be used
+//	History Log:	10/17/2026 written for portfolio aggregation
+//					10/17/2026 lines parsed in place by the mapped
+//					LoanReader
+//					10/17/2026 a chunk's loans calculated in parallel
+//					before they are added up
+//----------------------------------------------------------------------------
+int runPortfolioFile(const char* inName, const char* outName,
+	int bucketing, int bucketWidth, int threadCount)
+{
+	PortfolioFlows flows;
+	LoanReader reader;
+	LoanLine line;
+	CalculateJob job;
+	FILE * outFileHandle = NULL;
+	AmortRequest * requests = NULL;
+	AmortResult * loans = NULL;
+	size_t count = 0;
+	int opened = EXIT_FAILURE;
+	int returnValue = EXIT_SUCCESS;
+	int endOfFile = 0;
+
+	if (initPortfolioFlows(&flows, bucketing, bucketWidth) != EXIT_SUCCESS)
+	{
+		fprintf(stderr, "Cannot bucket the portfolio that way\n");
+		return EXIT_FAILURE;
+	}
+	opened = openLoanReader(&reader, inName);
+	outFileHandle = fopen(outName, "w");
+	requests = malloc(BATCH_CHUNK * sizeof(AmortRequest));
+	loans = malloc(BATCH_CHUNK * sizeof(AmortResult));
+	job.requests = requests;
+	job.loans = loans;
+	if (opened != EXIT_SUCCESS || outFileHandle == NULL || requests == NULL ||
+		loans == NULL)
+	{
+		fprintf(stderr, "Could not open %s or %s\n", inName, outName);
+		returnValue = EXIT_FAILURE;
+	}
+	else
+	{
+		while (!endOfFile && returnValue == EXIT_SUCCESS)
+		{
+			//fill one chunk
+			count = 0;
+			while (count < BATCH_CHUNK)
+			{
+				if (!readLoanLine(&reader, &line))
+				{
+					endOfFile = 1;
+					break;
+				}
+				if (line.status != AMORT_OK)
+				{
+					fprintf(stderr, "line %ld: %s\n", line.lineNumber,
+						amortStatusText(line.status));
+					flows.skipped++;
+					continue;
+				}
+				getLoanRequest(&line, &requests[count]);
+				count++;
+			}
+			if (parallelFor(count, PORTFOLIO_GRAIN, threadCount,
+				calculateSlice, &job) != EXIT_SUCCESS)
+			{
+				calculateSlice(&job, 0, count, 0);
+			}
+			returnValue = aggregatePortfolio(loans, count, threadCount,
+				&flows);
+		}
+		if (returnValue == EXIT_SUCCESS)
+		{
+			returnValue = writePortfolioFlows(outFileHandle, &flows);
+		}
+		if (flows.skipped > 0)
+		{
+			fprintf(stderr, "%lld record(s) could not be calculated\n",
+				flows.skipped);
+		}
+	}
+	closeLoanReader(&reader);
+	if (outFileHandle != NULL && fclose(outFileHandle) != ZERO)
+	{
+		returnValue = EXIT_FAILURE;
+	}
+	free(requests);
+	free(loans);
+	freePortfolioFlows(&flows);
+	return returnValue;
+}
@@ -0,0 +1,49 @@
+#ifndef AMORTPORTFOLIO_H
+#define AMORTPORTFOLIO_H
+#include <stddef.h>
+#include "AmortApi.h"
+#include "AmortCents.h"
+#define PORTFOLIO_TOTAL 0
+#define PORTFOLIO_BY_APR 1
+#define PORTFOLIO_BY_TERM 2
+#define PORTFOLIO_MONTHS AMORT_MAX_MONTHS
+#define PORTFOLIO_MAX_BUCKETS 64
+#define PORTFOLIO_APR_LIMIT 30
+#define PORTFOLIO_GRAIN 64
+//----------------------------------------------------------------------------
+// PortfolioFlows: the cash flows of many loans added up by month
+//		bucketing	PORTFOLIO_TOTAL, PORTFOLIO_BY_APR or PORTFOLIO_BY_TERM
+//		bucketWidth	APR points or months per bucket; the last APR bucket
+//					also holds every APR above PORTFOLIO_APR_LIMIT and the
+//					last term bucket every term past PORTFOLIO_MONTHS
+//		months		rows per bucket: PORTFOLIO_MONTHS, or the term of the
+//					longest loan added once one runs longer
+//		flows		bucketCount * months rows, month m of bucket b at
+//					flows[b * months + m - 1]; every row is the sum of the
+//					table rows rounded to the cent, the amounts AmTable.txt
+//					shows
+//		total		months rows, every bucket added together
+//		bucketLoans	loans in each bucket
+//		loans		loans added; skipped, loans that failed
+//----------------------------------------------------------------------------
+typedef struct PortfolioFlows {
+	int bucketing;
+	int bucketWidth;
+	int bucketCount;
+	int months;
+	CentsRow* flows;
+	CentsRow* total;
+	long long* bucketLoans;
+	long long loans;
+	long long skipped;
+} PortfolioFlows;
+int initPortfolioFlows(PortfolioFlows* flows, int bucketing,
+	int bucketWidth);
+void freePortfolioFlows(PortfolioFlows* flows);
+int getPortfolioBucket(const PortfolioFlows* flows, const AmortResult* loan);
+int aggregatePortfolio(const AmortResult* loans, size_t count,
+	int threadCount, PortfolioFlows* flows);
+int writePortfolioFlows(FILE* file, const PortfolioFlows* flows);
+int runPortfolioFile(const char* inName, const char* outName,
+	int bucketing, int bucketWidth, int threadCount);
+#endif
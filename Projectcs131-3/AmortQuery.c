@@ -0,0 +1,390 @@
+#include "AmortQuery.h"
+#include "AmortGrowth.h"
+#include "AmortCents.h"
+#include <stdlib.h>
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define HUNDRED 100
+#define INDEX_COLUMNS 4
+
+//----------------------------------------------------------------------------
+// ScheduleWalk: a loan's table read one row at a time, the same rows
+//		printTable() would print: the cents table when the loan is in
+//		ARITHMETIC_CENTS and the APR is on the grid, the double one
+//		otherwise
+//		cents		TRUE while reading the cents table
+//		balance, payment	the cents table's balance and level payment
+//----------------------------------------------------------------------------
+typedef struct ScheduleWalk {
+	ScheduleCursor cursor;
+	int cents;
+	int aprEighths;
+	long long balance;
+	long long payment;
+	int months;
+	int row;
+} ScheduleWalk;
+
+//----------------------------------------------------------------------------
+//	Function:		startWalk()
+//  Title:			Start walk
+//	Description:	This function will get ready to read a loan's table from
+//					its first row, choosing the table the way printTable()
+//					does. A loan amortCalculate() finished never owes more
+//					than its principal, so the principal is the only
+//					balance checked against getBalanceLimit()
+//	Input:			None
+//	Output:			None
+//	Calls:			toAprEighths()
+//					toCents()
+//					getBalanceLimit()
+//					initScheduleCursor()
+//	Parameters:		walk	(ScheduleWalk*)
+//					loan	(const AmortResult*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 arithmetic read from the loan
+//----------------------------------------------------------------------------
+static void startWalk(ScheduleWalk* walk, const AmortResult* loan)
+{
+	walk->cents = loan->arithmetic == ARITHMETIC_CENTS &&
+		toAprEighths(loan->monthlyRate, &walk->aprEighths) &&
+		toCents(loan->principal) <= getBalanceLimit(walk->aprEighths);
+	walk->balance = toCents(loan->principal);
+	walk->payment = toCents(loan->payment);
+	walk->months = loan->months;
+	walk->row = 0;
+	if (!walk->cents)
+	{
+		initScheduleCursor(&walk->cursor, loan->principal, loan->payment,
+			loan->monthlyRate, loan->months);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		nextWalkRow()
+//  Title:			Next walk row
+//	Description:	This function will read the next row of the table in
+//					cents as it is printed: a cents row as it is, or a
+//					double row from nextScheduleRow() with every amount
+//					rounded to the cent. The cents rows are worked out the
+//					way generateScheduleCents() works them
+//	Input:			None
+//	Output:			None
+//	Calls:			nextScheduleRow()
+//					toCents()
+//	Parameters:		walk	(ScheduleWalk*)
+//					row		(CentsRow*)
+//  Returns:		TRUE when row was filled, FALSE after the last row
+//	History Log:	10/17/2026 written for the schedule queries
+//----------------------------------------------------------------------------
+static int nextWalkRow(ScheduleWalk* walk, CentsRow* row)
+{
+	ScheduleRow doubleRow;
+	long long interest = 0;
+
+	if (walk->row >= walk->months)
+	{
+		return FALSE;
+	}
+	if (!walk->cents)
+	{
+		if (!nextScheduleRow(&walk->cursor, &doubleRow))
+		{
+			return FALSE;
+		}
+		walk->row++;
+		row->month = doubleRow.month;
+		row->payment = toCents(doubleRow.payment);
+		row->principalPaid = toCents(doubleRow.principalPaid);
+		row->interestPaid = toCents(doubleRow.interestPaid);
+		row->balance = toCents(doubleRow.balance);
+		return TRUE;
+	}
+	interest = (walk->balance * walk->aprEighths + CENTS_RATE_SCALE / 2) /
+		CENTS_RATE_SCALE;
+	row->month = ++walk->row;
+	row->interestPaid = interest;
+	if (walk->row == walk->months || walk->payment - interest >= walk->balance)
+	{
+		row->payment = walk->balance + interest;
+		row->principalPaid = walk->balance;
+		walk->balance = 0;
+		//the loan is paid off; nothing follows this row
+		walk->months = walk->row;
+	}
+	else
+	{
+		row->payment = walk->payment;
+		row->principalPaid = walk->payment - interest;
+		walk->balance -= row->principalPaid;
+	}
+	row->balance = walk->balance;
+	return TRUE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		buildScheduleIndex()
+//  Title:			Build schedule index
+//	Description:	This function will read a loan's table once, the rows
+//					printTable() would print, and keep the running sums of
+//					payment, principal and interest and the balance of
+//					every row, so the queries below never read the table
+//					again. It holds four numbers a month; free it with
+//					freeScheduleIndex()
+//	Input:			None
+//	Output:			None
+//	Calls:			startWalk()
+//					nextWalkRow()
+//					toCents()
+//	Parameters:		loan	(const AmortResult*) a loan amortCalculate()
+//							finished
+//					index	(ScheduleIndex*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the loan failed,
+//					has no months or memory runs out, leaving an empty
+//					index every query answers 0 from
+//	History Log:	10/17/2026 written so the queries are lookups instead
+//					of reading the table up to the month asked for
+//----------------------------------------------------------------------------
+int buildScheduleIndex(const AmortResult* loan, ScheduleIndex* index)
+{
+	ScheduleWalk walk;
+	CentsRow row;
+	size_t size = 0;
+
+	index->months = 0;
+	index->payment = NULL;
+	index->principalPaid = NULL;
+	index->interestPaid = NULL;
+	index->balance = NULL;
+	if (loan->status != AMORT_OK || loan->months <= ZERO)
+	{
+		return EXIT_FAILURE;
+	}
+	//row k at [k], and [0] before the first payment
+	size = (size_t)loan->months + ONE;
+	index->payment = malloc(INDEX_COLUMNS * size * sizeof(long long));
+	if (index->payment == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+	index->principalPaid = index->payment + size;
+	index->interestPaid = index->principalPaid + size;
+	index->balance = index->interestPaid + size;
+	index->payment[ZERO] = 0;
+	index->principalPaid[ZERO] = 0;
+	index->interestPaid[ZERO] = 0;
+	index->balance[ZERO] = toCents(loan->principal);
+	startWalk(&walk, loan);
+	row.month = 0;
+	while (nextWalkRow(&walk, &row))
+	{
+		index->payment[row.month] = index->payment[row.month - ONE] +
+			row.payment;
+		index->principalPaid[row.month] =
+			index->principalPaid[row.month - ONE] + row.principalPaid;
+		index->interestPaid[row.month] =
+			index->interestPaid[row.month - ONE] + row.interestPaid;
+		index->balance[row.month] = row.balance;
+	}
+	index->months = row.month;
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		freeScheduleIndex()
+//  Title:			Free schedule index
+//	Description:	This function will free what buildScheduleIndex() kept
+//					and leave the index empty
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		index	(ScheduleIndex*)
+//  Returns:		void
+//	History Log:	10/17/2026 written with buildScheduleIndex()
+//----------------------------------------------------------------------------
+void freeScheduleIndex(ScheduleIndex* index)
+{
+	free(index->payment);
+	index->months = 0;
+	index->payment = NULL;
+	index->principalPaid = NULL;
+	index->interestPaid = NULL;
+	index->balance = NULL;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getLevelBalanceAfter()
+//  Title:			Get level balance after
+//	Description:	This function will estimate the balance after month
+//					months in constant time from the annuity formula
+//					B(k) = P(1 + r)^k - A((1 + r)^k - 1) / r, rounded to
+//					the cent. It is only an estimate of the printed table:
+//					the double table works out the payment again every
+//					month and rounds it up, and the cents table rounds every
+//					month's interest, so over a long term at a high rate
+//					either can be hundreds or thousands of dollars away.
+//					getBalanceAfter() gives the printed balance. It can be
+//					0 or less once the loan is paid off. It needs no
+//					ScheduleIndex
+//	Input:			None
+//	Output:			None
+//	Calls:			getGrowthFactor()
+//					roundToNearestCent()
+//	Parameters:		loan	(const AmortResult*)
+//					month	(int)
+//  Returns:		the estimated balance
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 renamed from getLevelBalance() and made
+//					public as an estimate
+//----------------------------------------------------------------------------
+double getLevelBalanceAfter(const AmortResult* loan, int month)
+{
+	double growth = 0.0;
+	if (loan->monthlyRate == ZERO)
+	{
+		return roundToNearestCent(loan->principal - loan->payment * month);
+	}
+	growth = getGrowthFactor(loan->monthlyRate, month);
+	return roundToNearestCent(loan->principal * growth - loan->payment *
+		(growth - ONE) / loan->monthlyRate);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getPayoffMonth()
+//  Title:			Get payoff month
+//	Description:	This function will give the month of the last row the
+//					table prints: the loan's term for the double table,
+//					which levels its payment again every month, or sooner
+//					when a cents table's payment retires the loan early
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		index	(const ScheduleIndex*)
+//  Returns:		the month, or 0 when the loan has no schedule
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 read from the printed table
+//					10/17/2026 read from the index
+//----------------------------------------------------------------------------
+int getPayoffMonth(const ScheduleIndex* index)
+{
+	return index->months;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getBalanceAfter()
+//  Title:			Get balance after
+//	Description:	This function will give the balance printed on a
+//					month's row, 0 after the payoff, with one lookup.
+//					getLevelBalanceAfter() estimates it without an index
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		index	(const ScheduleIndex*)
+//					month	(int) 0 for the balance before any payment
+//  Returns:		the balance
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 read from the printed table
+//					10/17/2026 read from the index
+//----------------------------------------------------------------------------
+double getBalanceAfter(const ScheduleIndex* index, int month)
+{
+	if (index->balance == NULL)
+	{
+		return 0.0;
+	}
+	month = month < ZERO ? ZERO : month;
+	month = month > index->months ? index->months : month;
+	return (double)index->balance[month] / HUNDRED;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getPrincipalThrough()
+//  Title:			Get principal through
+//	Description:	This function will give the principal paid printed on
+//					rows 1 to month added up, with one lookup
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		index	(const ScheduleIndex*)
+//					month	(int)
+//  Returns:		the principal paid
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 read from the printed table
+//					10/17/2026 read from the index
+//----------------------------------------------------------------------------
+double getPrincipalThrough(const ScheduleIndex* index, int month)
+{
+	if (index->principalPaid == NULL || month <= ZERO)
+	{
+		return 0.0;
+	}
+	month = month > index->months ? index->months : month;
+	return (double)index->principalPaid[month] / HUNDRED;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getInterestThrough()
+//  Title:			Get interest through
+//	Description:	This function will give the interest printed on rows 1
+//					to month added up, with one lookup
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		index	(const ScheduleIndex*)
+//					month	(int)
+//  Returns:		the interest paid
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 read from the printed table
+//					10/17/2026 read from the index
+//----------------------------------------------------------------------------
+double getInterestThrough(const ScheduleIndex* index, int month)
+{
+	if (index->interestPaid == NULL || month <= ZERO)
+	{
+		return 0.0;
+	}
+	month = month > index->months ? index->months : month;
+	return (double)index->interestPaid[month] / HUNDRED;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getScheduleTotals()
+//  Title:			Get schedule totals
+//	Description:	This function will add up months first to last of a
+//					loan's table as they are printed, such as the interest
+//					paid in year 3 (months 25 to 36), as the running sums
+//					through last less those through first - 1
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		index	(const ScheduleIndex*)
+//					first	(int) from 1
+//					last	(int) months after the payoff add nothing
+//					totals	(ScheduleTotals*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the index is empty
+//					or the range is
+//	History Log:	10/17/2026 written for the schedule queries
+//					10/17/2026 read from the printed table
+//					10/17/2026 running sums from the index subtracted
+//----------------------------------------------------------------------------
+int getScheduleTotals(const ScheduleIndex* index, int first, int last,
+	ScheduleTotals* totals)
+{
+	if (index->payment == NULL || first < ONE || last < first)
+	{
+		return EXIT_FAILURE;
+	}
+	first = first - ONE > index->months ? index->months : first - ONE;
+	last = last > index->months ? index->months : last;
+	totals->payment = (double)(index->payment[last] -
+		index->payment[first]) / HUNDRED;
+	totals->principalPaid = (double)(index->principalPaid[last] -
+		index->principalPaid[first]) / HUNDRED;
+	totals->interestPaid = (double)(index->interestPaid[last] -
+		index->interestPaid[first]) / HUNDRED;
+	totals->balance = (double)index->balance[last] / HUNDRED;
+	return EXIT_SUCCESS;
+}
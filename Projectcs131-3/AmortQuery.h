@@ -0,0 +1,41 @@
+#ifndef AMORTQUERY_H
+#define AMORTQUERY_H
+#include "AmortApi.h"
+//----------------------------------------------------------------------------
+// ScheduleTotals: months first to last of a schedule added together, each
+//		row as the table prints it
+//		payment, principalPaid, interestPaid	sums over the months
+//		balance		what is left after month last
+//----------------------------------------------------------------------------
+typedef struct ScheduleTotals {
+	double payment;
+	double principalPaid;
+	double interestPaid;
+	double balance;
+} ScheduleTotals;
+//----------------------------------------------------------------------------
+// ScheduleIndex: a loan's printed table as running sums in cents, built
+//		once so any month or range of months is a lookup or a subtraction
+//		months		the rows the table prints, through the payoff
+//		payment, principalPaid, interestPaid	rows 1 to k added up at
+//					[k], 0 at [0]
+//		balance		the balance printed on row k at [k], the principal
+//					at [0]
+//----------------------------------------------------------------------------
+typedef struct ScheduleIndex {
+	int months;
+	long long* payment;
+	long long* principalPaid;
+	long long* interestPaid;
+	long long* balance;
+} ScheduleIndex;
+int buildScheduleIndex(const AmortResult* loan, ScheduleIndex* index);
+void freeScheduleIndex(ScheduleIndex* index);
+int getPayoffMonth(const ScheduleIndex* index);
+double getBalanceAfter(const ScheduleIndex* index, int month);
+double getLevelBalanceAfter(const AmortResult* loan, int month);
+double getPrincipalThrough(const ScheduleIndex* index, int month);
+double getInterestThrough(const ScheduleIndex* index, int month);
+int getScheduleTotals(const ScheduleIndex* index, int first, int last,
+	ScheduleTotals* totals);
+#endif
@@ -0,0 +1,305 @@
+#include "AmortRate.h"
+#include "AmortScenario.h"
+#include "AmortParallel.h"
+#define ONE 1
+#define ZERO 0
+#define MONTHPERCENT 1200
+
+//----------------------------------------------------------------------------
+// RateJob: what evaluateRatePaths() hands to its workers
+//----------------------------------------------------------------------------
+typedef struct RateJob {
+	double principal;
+	int months;
+	const RatePath* paths;
+	RateResult* results;
+} RateJob;
+
+//----------------------------------------------------------------------------
+//	Function:		checkRatePath()
+//  Title:			Check rate path
+//	Description:	This function will check a loan and its rate path the
+//					way amortCalculate() checks a fixed-rate loan
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		principal	(double)
+//					months		(int)
+//					path		(const RatePath*)
+//  Returns:		AMORT_OK or the AMORT_ status of the broken rule
+//	History Log:	10/17/2026 written for adjustable-rate schedules
+//----------------------------------------------------------------------------
+static int checkRatePath(double principal, int months, const RatePath* path)
+{
+	int i = 0;
+	if (!(principal > 0))
+	{
+		return AMORT_BAD_PRINCIPAL;
+	}
+	if (months <= ZERO || months > AMORT_MAX_MONTHS)
+	{
+		return AMORT_BAD_MONTHS;
+	}
+	if (path->count <= ZERO || path->segments[ZERO].firstMonth != ONE)
+	{
+		return AMORT_BAD_APR;
+	}
+	for (i = 0; i < path->count; i++)
+	{
+		if (!(path->segments[i].apr >= 0) || (i > ZERO &&
+			path->segments[i].firstMonth <= path->segments[i - ONE].firstMonth))
+		{
+			return AMORT_BAD_APR;
+		}
+	}
+	return AMORT_OK;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getSegmentEnd()
+//  Title:			Get segment end
+//	Description:	This function will find the last month of a segment
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		path	(const RatePath*)
+//					segment	(int)
+//					months	(int) the loan's term
+//  Returns:		the month before the next segment, or months
+//	History Log:	10/17/2026 written for adjustable-rate schedules
+//----------------------------------------------------------------------------
+static int getSegmentEnd(const RatePath* path, int segment, int months)
+{
+	if (segment + ONE < path->count &&
+		path->segments[segment + ONE].firstMonth - ONE < months)
+	{
+		return path->segments[segment + ONE].firstMonth - ONE;
+	}
+	return months;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		evaluateRatePath()
+//  Title:			Evaluate rate path
+//	Description:	This function will run an adjustable-rate loan along a
+//					rate path. At every reset the APR is rounded to the
+//					nearest eighth like the console rounds it, and the
+//					balance is amortized again over the months left with
+//					getPaymentAmount(). That payment holds until the next
+//					reset. Each segment costs one annuity formula, and the
+//					growth factors of APRs on the eighth grid come from
+//					the growth table, so a path costs a few lookups per
+//					reset whatever the term
+//	Input:			None
+//	Output:			None
+//	Calls:			checkRatePath()
+//					getSegmentEnd()
+//					roundToOneEighth()
+//					getPaymentAmount()
+//					getMonthsToPayoff()
+//					getSegmentBalance()
+//					roundToNextCent()
+//					roundToNearestCent()
+//	Parameters:		principal	(double) rounded to the cent
+//					months		(int)
+//					path		(const RatePath*)
+//					result		(RateResult*)
+//  Returns:		AMORT_OK or the status left in result->status
+//	History Log:	10/17/2026 written for adjustable-rate schedules
+//----------------------------------------------------------------------------
+int evaluateRatePath(double principal, int months, const RatePath* path,
+	RateResult* result)
+{
+	double balance = principal;
+	double monthlyRate = 0.0;
+	double payment = 0.0;
+	double paid = 0.0;
+	double ending = 0.0;
+	int month = 0;
+	int end = 0;
+	int payoff = 0;
+	int i = 0;
+
+	result->status = checkRatePath(principal, months, path);
+	result->payoffMonth = 0;
+	result->firstPayment = 0.0;
+	result->maxPayment = 0.0;
+	result->lastPayment = 0.0;
+	result->totalPaid = 0.0;
+	result->totalInterest = 0.0;
+	if (result->status != AMORT_OK)
+	{
+		return result->status;
+	}
+	for (i = 0; i < path->count && month < months; i++)
+	{
+		monthlyRate = roundToOneEighth(path->segments[i].apr) / MONTHPERCENT;
+		end = getSegmentEnd(path, i, months);
+		payment = getPaymentAmount(months - month, balance, monthlyRate);
+		if (i == ZERO)
+		{
+			result->firstPayment = payment;
+		}
+		//the payment covers the interest, so the balance only falls and
+		//the logarithm is needed only when it reaches 0 early
+		ending = getSegmentBalance(balance, payment, monthlyRate,
+			end - month);
+		if (ending < PAID_OFF || end == months)
+		{
+			payoff = end - month;
+			if (getSegmentBalance(balance, payment, monthlyRate,
+				payoff - ONE) < PAID_OFF)
+			{
+				payoff = getMonthsToPayoff(balance, payment, monthlyRate);
+			}
+			if (payoff > ONE && payment > result->maxPayment)
+			{
+				result->maxPayment = payment;
+			}
+			result->lastPayment = roundToNextCent(getSegmentBalance(balance,
+				payment, monthlyRate, payoff - ONE) * (ONE + monthlyRate));
+			paid += payment * (payoff - ONE) + result->lastPayment;
+			month += payoff;
+			break;
+		}
+		if (payment > result->maxPayment)
+		{
+			result->maxPayment = payment;
+		}
+		balance = ending;
+		paid += payment * (end - month);
+		month = end;
+	}
+	result->payoffMonth = month;
+	result->totalPaid = roundToNearestCent(paid);
+	result->totalInterest = roundToNearestCent(paid - principal);
+	return AMORT_OK;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		evaluateRateSlice()
+//  Title:			Evaluate rate slice
+//	Description:	This function will evaluate paths [begin, end) for one
+//					worker of evaluateRatePaths()
+//	Input:			None
+//	Output:			None
+//	Calls:			evaluateRatePath()
+//	Parameters:		context	(void*)
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for adjustable-rate schedules
+//----------------------------------------------------------------------------
+static void evaluateRateSlice(void* context, size_t begin, size_t end,
+	int worker)
+{
+	RateJob* job = (RateJob*)context;
+	size_t i = 0;
+	(void)worker;
+	for (i = begin; i < end; i++)
+	{
+		evaluateRatePath(job->principal, job->months, &job->paths[i],
+			&job->results[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		evaluateRatePaths()
+//  Title:			Evaluate rate paths
+//	Description:	This function will run one loan along many rate paths,
+//					such as Monte Carlo draws of the index, on threadCount
+//					threads (0 for every processor). Results land at the
+//					index of their path
+//	Input:			None
+//	Output:			None
+//	Calls:			parallelFor()
+//					evaluateRateSlice()
+//	Parameters:		principal	(double)
+//					months		(int)
+//					paths		(const RatePath*)
+//					results		(RateResult*)
+//					count		(size_t)
+//					threadCount	(int)
+//  Returns:		EXIT_SUCCESS
+//	History Log:	10/17/2026 written for adjustable-rate schedules
+//----------------------------------------------------------------------------
+int evaluateRatePaths(double principal, int months, const RatePath* paths,
+	RateResult* results, size_t count, int threadCount)
+{
+	RateJob job;
+	job.principal = principal;
+	job.months = months;
+	job.paths = paths;
+	job.results = results;
+	if (parallelFor(count, RATE_GRAIN, threadCount, evaluateRateSlice,
+		&job) != EXIT_SUCCESS)
+	{
+		evaluateRateSlice(&job, 0, count, 0);
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		generateRateSchedule()
+//  Title:			Generate rate schedule
+//	Description:	This function will fill the amortization table of an
+//					adjustable-rate loan one month at a time, with the
+//					payments evaluateRatePath() works out
+//	Input:			None
+//	Output:			None
+//	Calls:			checkRatePath()
+//					getSegmentEnd()
+//					roundToOneEighth()
+//					getPaymentAmount()
+//					roundToNextCent()
+//	Parameters:		principal	(double)
+//					months		(int)
+//					path		(const RatePath*)
+//					rows		(ScheduleRow*) room for months rows
+//  Returns:		the number of rows filled, 0 when the path is bad
+//	History Log:	10/17/2026 written for adjustable-rate schedules
+//----------------------------------------------------------------------------
+int generateRateSchedule(double principal, int months, const RatePath* path,
+	ScheduleRow* rows)
+{
+	double balance = principal;
+	double monthlyRate = 0.0;
+	double payment = 0.0;
+	double interestPaid = 0.0;
+	int month = 0;
+	int end = 0;
+	int i = 0;
+
+	if (checkRatePath(principal, months, path) != AMORT_OK)
+	{
+		return ZERO;
+	}
+	for (i = 0; i < path->count && month < months; i++)
+	{
+		monthlyRate = roundToOneEighth(path->segments[i].apr) / MONTHPERCENT;
+		end = getSegmentEnd(path, i, months);
+		payment = getPaymentAmount(months - month, balance, monthlyRate);
+		for (month++; month <= end; month++)
+		{
+			interestPaid = balance * monthlyRate;
+			rows[month - ONE].month = month;
+			rows[month - ONE].interestPaid = interestPaid;
+			if (month == months || balance + interestPaid - payment <
+				PAID_OFF)
+			{
+				rows[month - ONE].payment = roundToNextCent(balance +
+					interestPaid);
+				rows[month - ONE].principalPaid = balance;
+				rows[month - ONE].balance = 0;
+				return month;
+			}
+			rows[month - ONE].payment = payment;
+			rows[month - ONE].principalPaid = payment - interestPaid;
+			balance -= payment - interestPaid;
+			rows[month - ONE].balance = balance;
+		}
+		month = end;
+	}
+	return month;
+}
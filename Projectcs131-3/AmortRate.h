@@ -0,0 +1,44 @@
+#ifndef AMORTRATE_H
+#define AMORTRATE_H
+#include <stddef.h>
+#include "AmortApi.h"
+#define RATE_GRAIN 64
+//----------------------------------------------------------------------------
+// RateSegment: the APR from firstMonth until the next segment starts
+//----------------------------------------------------------------------------
+typedef struct RateSegment {
+	int firstMonth;
+	double apr;
+} RateSegment;
+//----------------------------------------------------------------------------
+// RatePath: the APRs of an adjustable-rate loan. The first segment starts
+//		at month 1 and each one starts later than the one before; a rate
+//		for every month is a path with one segment per month
+//----------------------------------------------------------------------------
+typedef struct RatePath {
+	const RateSegment* segments;
+	int count;
+} RatePath;
+//----------------------------------------------------------------------------
+// RateResult: how an adjustable-rate loan runs along one rate path
+//		status			AMORT_OK, or AMORT_BAD_PRINCIPAL, AMORT_BAD_MONTHS
+//						or AMORT_BAD_APR for a path out of order
+//		firstPayment	the payment until the first reset
+//		maxPayment		the largest payment before the last month
+//----------------------------------------------------------------------------
+typedef struct RateResult {
+	int status;
+	int payoffMonth;
+	double firstPayment;
+	double maxPayment;
+	double lastPayment;
+	double totalPaid;
+	double totalInterest;
+} RateResult;
+int evaluateRatePath(double principal, int months, const RatePath* path,
+	RateResult* result);
+int evaluateRatePaths(double principal, int months, const RatePath* paths,
+	RateResult* results, size_t count, int threadCount);
+int generateRateSchedule(double principal, int months, const RatePath* path,
+	ScheduleRow* rows);
+#endif
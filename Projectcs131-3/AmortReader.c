@@ -0,0 +1,502 @@
+#include "AmortReader.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define TEN 10
+#define HUNDRED 100
+#define EIGHTHS_PER_POINT 8
+#define FIELD_COUNT 4
+#define SIGNIFICANT_DIGITS 24
+#define MAX_EXPONENT 10000
+#define COPY_CHUNK (1 << 20)
+//up to 15 digits and 10^22 are exact doubles, so one * or / rounds once
+#define EXACT_DIGITS 15
+#define EXACT_POWER 22
+//"-0." digits, a sticky digit, "e-" and the exponent
+#define NUMBER_TEXT (SIGNIFICANT_DIGITS + 16)
+
+static const double powersOfTen[EXACT_POWER + 1] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+	1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+//----------------------------------------------------------------------------
+//	Function:		normalizeMode()
+//  Title:			Normalize mode
+//	Description:	This function will turn every menu key the console
+//					accepts for an option (1/P/p, 2/L/l, 3/N/n, 4/I/i)
+//					into the upper case letter of that option
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		key	(char)
+//  Returns:		'P', 'L', 'N', 'I' or 0 when the key is not an option
+//	History Log:	10/17/2026 written for the batch file mode
+//					10/17/2026 moved from AmortBatch.c
+//----------------------------------------------------------------------------
+char normalizeMode(char key)
+{
+	switch (key)
+	{
+		case '1':
+		case 'P':
+		case 'p':
+			return 'P';
+		case '2':
+		case 'L':
+		case 'l':
+			return 'L';
+		case '3':
+		case 'N':
+		case 'n':
+			return 'N';
+		case '4':
+		case 'I':
+		case 'i':
+			return 'I';
+		default:
+			return ZERO;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		skipBlanks()
+//  Title:			Skip blanks
+//	Description:	This function will step over spaces, tabs and carriage
+//					returns
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		cursor	(const char*)
+//					end		(const char*)
+//  Returns:		the first other character, or end
+//	History Log:	10/17/2026 written for the zero-copy reader
+//----------------------------------------------------------------------------
+static const char* skipBlanks(const char* cursor, const char* end)
+{
+	while (cursor < end && (*cursor == ' ' || *cursor == '\t' ||
+		*cursor == '\r'))
+	{
+		cursor++;
+	}
+	return cursor;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		parseNumber()
+//  Title:			Parse number
+//	Description:	This function will read a decimal
+//					"[+-]digits[.digits][e[+-]digits]", the numbers scanf()
+//					gives readApr() and the other read functions, straight
+//					from the bytes into the double scanf() would give, so
+//					the console's rounding of it gives the same cents and
+//					eighths. Up to 15 significant digits times a power of
+//					ten up to 10^22 is one exact division or product,
+//					rounded once as strtod() rounds; only longer numbers
+//					are handed to strtod(). No digits at all is an empty
+//					field and reads as 0
+//	Input:			None
+//	Output:			None
+//	Calls:			strtod()
+//	Parameters:		cursor		(const char*)
+//					end			(const char*)
+//					maxDigits	(int) digits allowed before the point
+//					value		(double*)
+//  Returns:		the character after the number, or NULL when it is not
+//					a number or has too many digits
+//	History Log:	10/17/2026 written for the zero-copy reader
+//					10/17/2026 gives the double scanf() reads instead of
+//					rounding the digits half up, which the console's
+//					rounding of that double does not always agree with
+//----------------------------------------------------------------------------
+static const char* parseNumber(const char* cursor, const char* end,
+	int maxDigits, double* value)
+{
+	char digits[SIGNIFICANT_DIGITS];
+	char text[NUMBER_TEXT];
+	long long mantissa = 0;
+	int count = 0;
+	int point = 0;
+	int exponent = 0;
+	int exponentSign = ONE;
+	int negative = FALSE;
+	int marked = FALSE;
+	int seen = FALSE;
+	int fraction = FALSE;
+	int sticky = FALSE;
+	int scale = 0;
+	int i = 0;
+
+	*value = 0.0;
+	if (cursor < end && (*cursor == '-' || *cursor == '+'))
+	{
+		negative = *cursor == '-';
+		marked = TRUE;
+		cursor++;
+	}
+	//the value is 0.digits times 10^point
+	for (; cursor < end; cursor++)
+	{
+		if (*cursor == '.' && !fraction)
+		{
+			fraction = TRUE;
+			marked = TRUE;
+			continue;
+		}
+		if ((unsigned)(*cursor - '0') >= TEN)
+		{
+			break;
+		}
+		seen = TRUE;
+		if (count == ZERO && *cursor == '0')
+		{
+			point -= fraction;
+			continue;
+		}
+		if (count < SIGNIFICANT_DIGITS)
+		{
+			digits[count++] = (char)(*cursor - '0');
+		}
+		else if (*cursor != '0')
+		{
+			sticky = TRUE;
+		}
+		point += !fraction;
+	}
+	if (!seen)
+	{
+		return marked ? NULL : cursor;
+	}
+	if (cursor < end && (*cursor == 'e' || *cursor == 'E'))
+	{
+		cursor++;
+		if (cursor < end && (*cursor == '-' || *cursor == '+'))
+		{
+			exponentSign = *cursor == '-' ? -ONE : ONE;
+			cursor++;
+		}
+		if (cursor == end || (unsigned)(*cursor - '0') >= TEN)
+		{
+			return NULL;
+		}
+		for (; cursor < end && (unsigned)(*cursor - '0') < TEN; cursor++)
+		{
+			if (exponent < MAX_EXPONENT)
+			{
+				exponent = exponent * TEN + (*cursor - '0');
+			}
+		}
+		point += exponentSign * exponent;
+	}
+	if (count == ZERO)
+	{
+		return cursor;
+	}
+	if (point > maxDigits)
+	{
+		return NULL;
+	}
+	//trailing zeros are only part of the power of ten
+	while (digits[count - ONE] == ZERO && !sticky)
+	{
+		count--;
+	}
+	scale = point - count;
+	if (count <= EXACT_DIGITS && !sticky && scale >= -EXACT_POWER &&
+		scale <= EXACT_POWER)
+	{
+		for (i = 0; i < count; i++)
+		{
+			mantissa = mantissa * TEN + digits[i];
+		}
+		*value = scale < ZERO ? (double)mantissa / powersOfTen[-scale] :
+			(double)mantissa * powersOfTen[scale];
+	}
+	else
+	{
+		//the kept digits, and one more when any digit past them is not 0
+		text[ZERO] = '.';
+		for (i = 0; i < count; i++)
+		{
+			text[i + ONE] = (char)('0' + digits[i]);
+		}
+		sprintf(text + count + ONE, "%se%d", sticky ? "1" : "", point);
+		*value = strtod(text, NULL);
+	}
+	if (negative)
+	{
+		*value = -*value;
+	}
+	return cursor;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		parseLoanLine()
+//  Title:			Parse loan line
+//	Description:	This function will read one line "mode,apr,principal,
+//					payment,months" without its newline into whole cents
+//					and eighths of a point, then check the fields the mode
+//					needs in the order amortCalculate() does. Every number
+//					is rounded the way the console rounds what it reads:
+//					roundToOneEighth() for the APR and roundToNearestCent()
+//					for the amounts, so "1.005" is $1.00 here as it is at
+//					the menu
+//	Input:			None
+//	Output:			None
+//	Calls:			skipBlanks()
+//					normalizeMode()
+//					parseNumber()
+//					roundToOneEighth()
+//					toCents()
+//	Parameters:		text	(const char*)
+//					end		(const char*) the newline or the end of file
+//					line	(LoanLine*)
+//  Returns:		line->status
+//	History Log:	10/17/2026 written for the zero-copy reader
+//					10/17/2026 rounded like the console, not half up from
+//					the digits
+//----------------------------------------------------------------------------
+int parseLoanLine(const char* text, const char* end, LoanLine* line)
+{
+	static const int maxDigits[FIELD_COUNT] = { READER_APR_DIGITS,
+		READER_AMOUNT_DIGITS, READER_AMOUNT_DIGITS, READER_MONTH_DIGITS };
+	double values[FIELD_COUNT] = { 0.0, 0.0, 0.0, 0.0 };
+	const char* cursor = skipBlanks(text, end);
+	char mode = cursor < end ? normalizeMode(*cursor) : ZERO;
+	int field = 0;
+
+	//a line that is not a record keeps its first character as the mode
+	line->mode = text < end ? *text : ' ';
+	line->aprEighths = 0;
+	line->principalCents = 0;
+	line->paymentCents = 0;
+	line->months = 0;
+	line->status = AMORT_BAD_FORMAT;
+	if (mode == ZERO)
+	{
+		return line->status;
+	}
+	cursor++;
+	for (field = 0; field < FIELD_COUNT; field++)
+	{
+		cursor = skipBlanks(cursor, end);
+		if (cursor == end || *cursor != ',')
+		{
+			return line->status;
+		}
+		cursor = parseNumber(skipBlanks(cursor + ONE, end), end,
+			maxDigits[field], &values[field]);
+		if (cursor == NULL)
+		{
+			return line->status;
+		}
+	}
+	//months must be a whole number, the way readMonth() reads an int
+	if (skipBlanks(cursor, end) != end || values[3] != floor(values[3]))
+	{
+		return line->status;
+	}
+	line->mode = mode;
+	line->aprEighths = (int)(roundToOneEighth(fabs(values[0])) *
+		EIGHTHS_PER_POINT);
+	line->principalCents = toCents(values[1]);
+	line->paymentCents = toCents(values[2]);
+	line->months = (int)values[3];
+	if (line->mode != 'I' && values[0] < ZERO)
+	{
+		line->status = AMORT_BAD_APR;
+	}
+	else if (line->mode != 'L' && line->principalCents <= ZERO)
+	{
+		line->status = AMORT_BAD_PRINCIPAL;
+	}
+	else if (line->mode != 'P' && line->paymentCents <= ZERO)
+	{
+		line->status = AMORT_BAD_PAYMENT;
+	}
+	else if (line->mode != 'N' &&
+		(line->months <= ZERO || line->months > AMORT_MAX_MONTHS))
+	{
+		line->status = AMORT_BAD_MONTHS;
+	}
+	else
+	{
+		line->status = AMORT_OK;
+	}
+	return line->status;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getLoanRequest()
+//  Title:			Get loan request
+//	Description:	This function will turn a line into the request
+//					amortCalculate() takes. Cents and eighths convert to
+//					doubles the rounding in amortCalculate() leaves alone,
+//					with ARITHMETIC_DOUBLE for the caller to change
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		line	(const LoanLine*)
+//					request	(AmortRequest*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the zero-copy reader
+//----------------------------------------------------------------------------
+void getLoanRequest(const LoanLine* line, AmortRequest* request)
+{
+	request->mode = line->mode;
+	request->apr = (double)line->aprEighths / EIGHTHS_PER_POINT;
+	request->principal = (double)line->principalCents / HUNDRED;
+	request->payment = (double)line->paymentCents / HUNDRED;
+	request->months = line->months;
+	request->arithmetic = ARITHMETIC_DOUBLE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		copyLoanFile()
+//  Title:			Copy loan file
+//	Description:	This function will read a file that could not be
+//					mapped, such as a pipe, into memory
+//	Input:			the loan file
+//	Output:			None
+//	Calls:			None
+//	Parameters:		reader	(LoanReader*)
+//					name	(const char*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the file cannot be
+//					opened or memory runs out
+//	History Log:	10/17/2026 written for the zero-copy reader
+//----------------------------------------------------------------------------
+static int copyLoanFile(LoanReader* reader, const char* name)
+{
+	FILE * inFileHandle = fopen(name, "rb");
+	char* grown = NULL;
+	size_t size = 0;
+	size_t capacity = 0;
+	size_t got = 0;
+	int returnValue = EXIT_SUCCESS;
+
+	if (inFileHandle == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+	do
+	{
+		if (size == capacity)
+		{
+			capacity += COPY_CHUNK;
+			grown = realloc(reader->copy, capacity);
+			if (grown == NULL)
+			{
+				returnValue = EXIT_FAILURE;
+				break;
+			}
+			reader->copy = grown;
+		}
+		got = fread(reader->copy + size, ONE, capacity - size, inFileHandle);
+		size += got;
+	} while (got > ZERO);
+	if (ferror(inFileHandle))
+	{
+		returnValue = EXIT_FAILURE;
+	}
+	fclose(inFileHandle);
+	reader->next = reader->copy;
+	reader->end = reader->copy + size;
+	return returnValue;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		openLoanReader()
+//  Title:			Open loan reader
+//	Description:	This function will map a loan file for readLoanLine()
+//	Input:			the loan file
+//	Output:			None
+//	Calls:			mapFile()
+//					copyLoanFile()
+//	Parameters:		reader	(LoanReader*)
+//					name	(const char*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when it cannot be read
+//	History Log:	10/17/2026 written for the zero-copy reader
+//----------------------------------------------------------------------------
+int openLoanReader(LoanReader* reader, const char* name)
+{
+	reader->copy = NULL;
+	reader->next = NULL;
+	reader->end = NULL;
+	reader->lineNumber = 0;
+	if (mapFile(&reader->map, name) == EXIT_SUCCESS &&
+		reader->map.size > ZERO)
+	{
+		reader->next = reader->map.data;
+		reader->end = reader->map.data + reader->map.size;
+		return EXIT_SUCCESS;
+	}
+	//an empty map may just be a pipe, whose size is not known up front
+	unmapFile(&reader->map);
+	return copyLoanFile(reader, name);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readLoanLine()
+//  Title:			Read loan line
+//	Description:	This function will parse the next record, skipping
+//					blank lines and lines starting with '#'
+//	Input:			None
+//	Output:			None
+//	Calls:			skipBlanks()
+//					parseLoanLine()
+//	Parameters:		reader	(LoanReader*)
+//					line	(LoanLine*)
+//  Returns:		TRUE when a record was read, FALSE at the end of file
+//	History Log:	10/17/2026 written for the zero-copy reader
+//----------------------------------------------------------------------------
+int readLoanLine(LoanReader* reader, LoanLine* line)
+{
+	const char* text = NULL;
+	const char* lineEnd = NULL;
+	while (reader->next < reader->end)
+	{
+		text = reader->next;
+		lineEnd = memchr(text, '\n', reader->end - text);
+		if (lineEnd == NULL)
+		{
+			lineEnd = reader->end;
+		}
+		reader->next = lineEnd < reader->end ? lineEnd + ONE : lineEnd;
+		reader->lineNumber++;
+		if (*text == '#' || skipBlanks(text, lineEnd) == lineEnd)
+		{
+			continue;
+		}
+		line->lineNumber = reader->lineNumber;
+		parseLoanLine(text, lineEnd, line);
+		return TRUE;
+	}
+	return FALSE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		closeLoanReader()
+//  Title:			Close loan reader
+//	Description:	This function will release the mapping or the copy,
+//					also after openLoanReader() failed
+//	Input:			None
+//	Output:			None
+//	Calls:			unmapFile()
+//	Parameters:		reader	(LoanReader*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the zero-copy reader
+//----------------------------------------------------------------------------
+void closeLoanReader(LoanReader* reader)
+{
+	if (reader->copy == NULL)
+	{
+		unmapFile(&reader->map);
+	}
+	free(reader->copy);
+	reader->copy = NULL;
+	reader->next = NULL;
+	reader->end = NULL;
+}
@@ -0,0 +1,45 @@
+#ifndef AMORTREADER_H
+#define AMORTREADER_H
+#include "AmortApi.h"
+#include "AmortMap.h"
+#define READER_AMOUNT_DIGITS 15
+#define READER_APR_DIGITS 8
+#define READER_MONTH_DIGITS 9
+//----------------------------------------------------------------------------
+// LoanLine: one record of a loan file in whole units
+//		status		AMORT_OK, AMORT_BAD_FORMAT when the line is not
+//					"mode,apr,principal,payment,months", or the first rule
+//					of readApr(), readPrincipal(), readPayment() and
+//					readMonth() a field the mode needs breaks
+//		mode		'P', 'L', 'N' or 'I', or the first character of a line
+//					that is not a record
+//		aprEighths, principalCents, paymentCents rounded the way the
+//		console rounds the same text; an empty field is 0
+//----------------------------------------------------------------------------
+typedef struct LoanLine {
+	long lineNumber;
+	int status;
+	char mode;
+	int aprEighths;
+	long long principalCents;
+	long long paymentCents;
+	int months;
+} LoanLine;
+//----------------------------------------------------------------------------
+// LoanReader: walks the lines of a mapped loan file. A file that cannot
+//		be mapped, like a pipe, is read into copy instead
+//----------------------------------------------------------------------------
+typedef struct LoanReader {
+	MappedFile map;
+	char* copy;
+	const char* next;
+	const char* end;
+	long lineNumber;
+} LoanReader;
+char normalizeMode(char key);
+int parseLoanLine(const char* text, const char* end, LoanLine* line);
+void getLoanRequest(const LoanLine* line, AmortRequest* request);
+int openLoanReader(LoanReader* reader, const char* name);
+int readLoanLine(LoanReader* reader, LoanLine* line);
+void closeLoanReader(LoanReader* reader);
+#endif
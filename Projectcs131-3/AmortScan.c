@@ -0,0 +1,362 @@
+#include "AmortScan.h"
+#include "AmortParallel.h"
+#include "AmortWriter.h"
+#include <stdlib.h>
+#include <float.h>
+#define ONE 1
+#define ZERO 0
+#define HALF 0.5
+#define HUNDRED 100
+#define SCAN_APR_LIMIT 100
+
+//----------------------------------------------------------------------------
+// AffineMap: what one or more periods do to a balance,
+//		balance -> scale * balance + shift. A period at rate r paying p is
+//		{ 1 + r, -p }; maps compose, so the balance after any number of
+//		periods comes from one map instead of one period after another
+//----------------------------------------------------------------------------
+typedef struct AffineMap {
+	double scale;
+	double shift;
+} AffineMap;
+
+//----------------------------------------------------------------------------
+// ScanJob: what scanScheduleCents() hands to its workers
+//		period	the map of one period, in cents
+//		block	periods in a block
+//		starts	the balance before each block, from the scan
+//		ends	the row in each block that closes the loan, or -1
+//----------------------------------------------------------------------------
+typedef struct ScanJob {
+	long long principalCents;
+	long long paymentCents;
+	double periodRate;
+	int periods;
+	int block;
+	AffineMap period;
+	const double* starts;
+	int* ends;
+	CentsRow* rows;
+} ScanJob;
+
+//----------------------------------------------------------------------------
+//	Function:		repeatAffineMap()
+//  Title:			Repeat affine map
+//	Description:	This function will give the map of count periods that
+//					all do period, balance -> a^count * balance +
+//					shift * (a^count - 1) / (a - 1). a^count - 1 comes from
+//					expm1() and log1p() so it keeps its digits when a is
+//					close to 1, which multiplying or squaring the maps
+//					count times would not
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		period	(AffineMap)
+//					count	(int)
+//  Returns:		period done count times
+//	History Log:	10/17/2026 written for the prefix scan
+//----------------------------------------------------------------------------
+static AffineMap repeatAffineMap(AffineMap period, int count)
+{
+	AffineMap repeated;
+	double rate = period.scale - ONE;
+	double growth = 0.0;
+	if (rate == ZERO)
+	{
+		repeated.scale = ONE;
+		repeated.shift = period.shift * count;
+		return repeated;
+	}
+	growth = expm1(count * log1p(rate));
+	repeated.scale = ONE + growth;
+	repeated.shift = period.shift * (growth / rate);
+	return repeated;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		scanBlocks()
+//  Title:			Scan blocks
+//	Description:	This function will fill the rows of blocks [begin, end)
+//					for one worker of scanScheduleCents(). Each block runs
+//					its periods on from the balance the scan gave it, and
+//					takes its last balance from the next block's start so
+//					the two agree to the bit. A block whose start is
+//					already paid off comes after the row that closed the
+//					loan and is skipped. The cent fix-up is done as the
+//					rows are written: every balance is rounded to the
+//					nearest cent, the principal paid is the drop in the
+//					rounded balance and the interest is the rest of the
+//					payment, so principal paid adds up to the loan. The row
+//					where the balance reaches 0, or the last period, pays
+//					off what is left
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		context	(void*) the ScanJob
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the prefix scan
+//----------------------------------------------------------------------------
+static void scanBlocks(void* context, size_t begin, size_t end, int worker)
+{
+	ScanJob* job = (ScanJob*)context;
+	CentsRow* row = NULL;
+	double balance = 0.0;
+	long long previous = 0;
+	long long cents = 0;
+	size_t block = 0;
+	int first = 0;
+	int last = 0;
+	int i = 0;
+
+	(void)worker;
+	for (block = begin; block < end; block++)
+	{
+		first = (int)block * job->block;
+		last = job->periods - first > job->block ? first + job->block :
+			job->periods;
+		balance = job->starts[block];
+		job->ends[block] = -1;
+		if (block > ZERO && !(balance >= HALF))
+		{
+			continue;
+		}
+		previous = block == ZERO ? job->principalCents :
+			(long long)floor(balance + HALF);
+		for (i = first; i < last; i++)
+		{
+			if (i == last - ONE && last < job->periods)
+			{
+				balance = job->starts[block + ONE];
+			}
+			else
+			{
+				balance = job->period.scale * balance + job->period.shift;
+			}
+			row = &job->rows[i];
+			row->month = i + ONE;
+			if (!(balance >= HALF) || i == job->periods - ONE)
+			{
+				row->interestPaid = (long long)floor(previous *
+					job->periodRate + HALF);
+				row->principalPaid = previous;
+				row->payment = previous + row->interestPaid;
+				row->balance = 0;
+				job->ends[block] = i;
+				break;
+			}
+			cents = (long long)floor(balance + HALF);
+			row->payment = job->paymentCents;
+			row->principalPaid = previous - cents;
+			row->interestPaid = job->paymentCents - row->principalPaid;
+			row->balance = cents;
+			previous = cents;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		scanScheduleCents()
+//  Title:			Scan schedule in cents
+//	Description:	This function will fill the table of a level-payment
+//					loan of any length, periods of any size, with the
+//					balances worked out by a prefix scan of the periods'
+//					affine maps instead of one after another. The periods
+//					are cut into blocks of SCAN_BLOCK; one period's map
+//					repeated over a block carries the balance from the
+//					start of each block to the next, then the blocks fill
+//					their rows side by side on threadCount threads (0 for
+//					every processor). Balances follow the unrounded loan
+//					and are rounded to the cent as each row is written.
+//					A rate so high that a block's growth runs past a double
+//					leaves the whole table as one block.
+//					The table is the same for any thread count, but not
+//					the one running the periods one after another would
+//					give: a block starts from the closed-form balance, a
+//					few units in the last place off the serial one, so a
+//					balance within that of a half cent can round the other
+//					way, and where it does depends on SCAN_BLOCK. While the
+//					principal grown over the periods keeps that error under
+//					a thousandth of a cent, every balance is within a cent
+//					of the serial one and the table ends on the same row
+//					(ScanTest finds 11 of 678,440 balances a cent apart).
+//					Past that the payment cancels a grown principal wider
+//					than a double in either form and both lose cents.
+//					Only the block starts come from the scan; the rows of
+//					a block are still one period after another, about as
+//					fast as generateScheduleCents(). So the speedup is at
+//					most the number of processors, less once writing 40
+//					bytes a row fills the memory bus, and none on one
+//					processor
+//	Input:			None
+//	Output:			None
+//	Calls:			repeatAffineMap()
+//					parallelFor()
+//					scanBlocks()
+//	Parameters:		principalCents	(long long)
+//					paymentCents	(long long)
+//					periodRate		(double) interest rate per period
+//					periods			(int)
+//					rows			(CentsRow*) room for periods rows
+//					threadCount		(int)
+//  Returns:		the number of rows filled, or -1 when memory runs out
+//	History Log:	10/17/2026 Complete version 1.0
+//					10/17/2026 tolerance against the serial table and
+//					scaling written down
+//----------------------------------------------------------------------------
+int scanScheduleCents(long long principalCents, long long paymentCents,
+	double periodRate, int periods, CentsRow* rows, int threadCount)
+{
+	ScanJob job;
+	AffineMap blockMap;
+	double* starts = NULL;
+	int* ends = NULL;
+	size_t blocks = 0;
+	size_t block = 0;
+	int i = 0;
+
+	if (periods <= ZERO)
+	{
+		return ZERO;
+	}
+	blocks = ((size_t)periods + SCAN_BLOCK - ONE) / SCAN_BLOCK;
+	starts = malloc(blocks * sizeof(double));
+	ends = malloc(blocks * sizeof(int));
+	if (starts == NULL || ends == NULL)
+	{
+		free(starts);
+		free(ends);
+		return -1;
+	}
+	job.principalCents = principalCents;
+	job.paymentCents = paymentCents;
+	job.periodRate = periodRate;
+	job.periods = periods;
+	job.period.scale = ONE + periodRate;
+	job.period.shift = -(double)paymentCents;
+	job.block = SCAN_BLOCK;
+	job.starts = starts;
+	job.ends = ends;
+	job.rows = rows;
+	//every period is the same, so every whole block is the same map
+	blockMap = repeatAffineMap(job.period, SCAN_BLOCK);
+	if (!(blockMap.scale <= DBL_MAX && -blockMap.shift <= DBL_MAX))
+	{
+		job.block = periods;
+		blocks = ONE;
+	}
+	starts[ZERO] = (double)principalCents;
+	for (block = ONE; block < blocks; block++)
+	{
+		starts[block] = blockMap.scale * starts[block - ONE] + blockMap.shift;
+	}
+	if (parallelFor(blocks, ONE, threadCount, scanBlocks, &job) !=
+		EXIT_SUCCESS)
+	{
+		scanBlocks(&job, 0, blocks, 0);
+	}
+	//the first block that closed the loan ends the table
+	block = 0;
+	while (ends[block] < ZERO)
+	{
+		block++;
+	}
+	i = ends[block] + ONE;
+	free(starts);
+	free(ends);
+	return i;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runScanSchedule()
+//  Title:			Run scan schedule
+//	Description:	This function will write the whole-cent table of a loan
+//					paid periodsPerYear times a year for periods periods,
+//					at the level payment getPaymentAmount() gives for the
+//					period rate, using scanScheduleCents() so a table of
+//					millions of daily periods is built on every core
+//	Input:			None
+//	Output:			the table file, errors to stderr
+//	Calls:			roundToOneEighth()
+//					getPaymentAmount()
+//					roundToNextCent()
+//					toCents()
+//					scanScheduleCents()
+//					openTableWriter()
+//					writeCentsRows()
+//					closeTableWriter()
+//	Parameters:		outName			(const char*)
+//					principal		(double)
+//					apr				(double)
+//					periods			(int)
+//					periodsPerYear	(int)
+//					threadCount		(int)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the loan is out of
+//					range or the file cannot be written
+//	History Log:	10/17/2026 written for the prefix scan
+//----------------------------------------------------------------------------
+int runScanSchedule(const char* outName, double principal, double apr,
+	int periods, int periodsPerYear, int threadCount)
+{
+	TableWriter writer;
+	CentsRow* rows = NULL;
+	FILE * outFileHandle = NULL;
+	long long principalCents = toCents(principal);
+	double periodRate = 0.0;
+	double payment = 0.0;
+	int count = 0;
+	int returnValue = EXIT_SUCCESS;
+
+	if (principalCents <= ZERO || !(apr >= ZERO) || apr > SCAN_APR_LIMIT ||
+		periods <= ZERO || periods > SCAN_MAX_PERIODS || periodsPerYear <= ZERO)
+	{
+		fprintf(stderr, "The principal must be above 0, the APR from 0 to %d "
+			"and the periods from 1 to %d\n", SCAN_APR_LIMIT,
+			SCAN_MAX_PERIODS);
+		return EXIT_FAILURE;
+	}
+	apr = roundToOneEighth(apr);
+	periodRate = apr / ((double)HUNDRED * periodsPerYear);
+	payment = getPaymentAmount(periods, (double)principalCents / HUNDRED,
+		periodRate);
+	if (!(payment >= ZERO && payment <= principal + principal * periodRate))
+	{
+		//(1 + rate)^periods ran past a double: the interest-only payment
+		payment = roundToNextCent((double)principalCents / HUNDRED *
+			periodRate);
+	}
+	rows = malloc((size_t)periods * sizeof(CentsRow));
+	if (rows == NULL || (count = scanScheduleCents(principalCents,
+		toCents(payment), periodRate, periods, rows, threadCount)) < ZERO)
+	{
+		fprintf(stderr, "Not enough memory for %d periods\n", periods);
+		free(rows);
+		return EXIT_FAILURE;
+	}
+	outFileHandle = fopen(outName, "w");
+	if (outFileHandle == NULL)
+	{
+		fprintf(stderr, "Could not open %s\n", outName);
+		free(rows);
+		return EXIT_FAILURE;
+	}
+	fprintf(outFileHandle, "Amortization Table for $%lld.%02lld Loan at "
+		"%.3lf%% interest for %d periods of 1/%d year\n\n%s %22s %15s %15s\n",
+		principalCents / HUNDRED, principalCents % HUNDRED, apr, periods,
+		periodsPerYear, "Payments", "Principal Paid", "Interest Paid",
+		"Loan Balance");
+	returnValue = openTableWriter(&writer, outFileHandle);
+	if (returnValue == EXIT_SUCCESS)
+	{
+		writeCentsRows(&writer, rows, count);
+		returnValue = closeTableWriter(&writer);
+	}
+	if (fclose(outFileHandle) != ZERO)
+	{
+		returnValue = EXIT_FAILURE;
+	}
+	free(rows);
+	return returnValue;
+}
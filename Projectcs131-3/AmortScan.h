@@ -0,0 +1,11 @@
+#ifndef AMORTSCAN_H
+#define AMORTSCAN_H
+#include "AmortCents.h"
+#define SCAN_BLOCK 4096
+#define SCAN_PERIODS_PER_YEAR 12
+#define SCAN_MAX_PERIODS 50000000
+int scanScheduleCents(long long principalCents, long long paymentCents,
+	double periodRate, int periods, CentsRow* rows, int threadCount);
+int runScanSchedule(const char* outName, double principal, double apr,
+	int periods, int periodsPerYear, int threadCount);
+#endif
@@ -0,0 +1,382 @@
+#include "AmortScenario.h"
+#include "AmortGrowth.h"
+#include "AmortParallel.h"
+#include <limits.h>
+#define ONE 1
+#define ZERO 0
+
+//----------------------------------------------------------------------------
+// ScenarioJob: what runScenarioBatch() hands to its workers
+//----------------------------------------------------------------------------
+typedef struct ScenarioJob {
+	const AmortResult* loan;
+	const PrepayScenario* scenarios;
+	ScenarioResult* results;
+	const ScenarioResult* baseline;
+} ScenarioJob;
+
+//----------------------------------------------------------------------------
+//	Function:		getSegmentBalance()
+//  Title:			Get segment balance
+//	Description:	This function will find the balance after months
+//					payments of the same amount from the annuity formula,
+//					without walking the months
+//	Input:			None
+//	Output:			None
+//	Calls:			getGrowthFactor()
+//	Parameters:		balance		(double) before the first of the months
+//					outflow		(double) paid every month
+//					monthlyRate	(double)
+//					months		(int)
+//  Returns:		the balance, 0 or less once it is paid off
+//	History Log:	10/17/2026 written for prepayment scenarios
+//					10/17/2026 shared with AmortRate.c
+//----------------------------------------------------------------------------
+double getSegmentBalance(double balance, double outflow,
+	double monthlyRate, int months)
+{
+	double growth = 0.0;
+	if (monthlyRate == ZERO)
+	{
+		return balance - outflow * months;
+	}
+	growth = getGrowthFactor(monthlyRate, months);
+	return balance * growth - outflow * (growth - ONE) / monthlyRate;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getMonthsToPayoff()
+//  Title:			Get months to payoff
+//	Description:	This function will find how many payments of outflow
+//					pay off balance. getNumberOfMonths() gives the answer
+//					and the balances on either side of it are checked, so
+//					float error in the logarithm cannot put it a month off
+//	Input:			None
+//	Output:			None
+//	Calls:			getNumberOfMonths()
+//					getSegmentBalance()
+//	Parameters:		balance		(double)
+//					outflow		(double)
+//					monthlyRate	(double)
+//  Returns:		the months, or NEVER when outflow does not cover the
+//					interest
+//	History Log:	10/17/2026 written for prepayment scenarios
+//					10/17/2026 shared with AmortRate.c
+//----------------------------------------------------------------------------
+int getMonthsToPayoff(double balance, double outflow, double monthlyRate)
+{
+	int months = 0;
+	if (!(outflow > balance * monthlyRate) || !(outflow > ZERO))
+	{
+		return NEVER;
+	}
+	months = getNumberOfMonths(balance, outflow, monthlyRate);
+	if (months < ONE)
+	{
+		months = ONE;
+	}
+	while (months > ONE && getSegmentBalance(balance, outflow, monthlyRate,
+		months - ONE) < PAID_OFF)
+	{
+		months--;
+	}
+	while (getSegmentBalance(balance, outflow, monthlyRate, months) >=
+		PAID_OFF)
+	{
+		months++;
+	}
+	return months;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		simulateScenario()
+//  Title:			Simulate scenario
+//	Description:	This function will play a scenario out in stretches of
+//					months that pay the same amount: up to the month the
+//					recurring extra starts, up to the lump sum, and from
+//					there to the payoff. Each stretch costs one annuity
+//					formula instead of a loop over its months, so a
+//					scenario costs the same for a 36 or a 360 month loan.
+//					The payment stays level; extra principal brings the
+//					payoff date in, as with most lenders
+//	Input:			None
+//	Output:			None
+//	Calls:			getMonthsToPayoff()
+//					getSegmentBalance()
+//					roundToNextCent()
+//					roundToNearestCent()
+//	Parameters:		loan		(const AmortResult*)
+//					scenario	(const PrepayScenario*)
+//					result		(ScenarioResult*) the saved fields are
+//								left alone
+//  Returns:		AMORT_OK or the status left in result->status
+//	History Log:	10/17/2026 written for prepayment scenarios
+//----------------------------------------------------------------------------
+static int simulateScenario(const AmortResult* loan,
+	const PrepayScenario* scenario, ScenarioResult* result)
+{
+	double balance = loan->principal;
+	double outflow = 0.0;
+	double paid = 0.0;
+	int extraStart = INT_MAX;
+	int lumpMonth = INT_MAX;
+	int month = 0;
+	int end = 0;
+	int months = 0;
+
+	result->status = loan->status;
+	if (loan->status == AMORT_OK && (!(scenario->extraMonthly >= ZERO) ||
+		!(scenario->lumpSum >= ZERO)))
+	{
+		result->status = AMORT_BAD_PAYMENT;
+	}
+	if (result->status != AMORT_OK)
+	{
+		return result->status;
+	}
+	if (scenario->extraMonthly > ZERO)
+	{
+		extraStart = scenario->extraStart > ONE ? scenario->extraStart : ONE;
+	}
+	if (scenario->lumpSum > ZERO && scenario->lumpMonth > ZERO)
+	{
+		lumpMonth = scenario->lumpMonth;
+	}
+	for (;;)
+	{
+		outflow = loan->payment;
+		end = INT_MAX;
+		if (month + ONE >= extraStart)
+		{
+			outflow += scenario->extraMonthly;
+		}
+		else
+		{
+			end = extraStart - ONE;
+		}
+		if (lumpMonth > month && lumpMonth < end)
+		{
+			end = lumpMonth;
+		}
+		months = getMonthsToPayoff(balance, outflow, loan->monthlyRate);
+		if (months != NEVER && (end == INT_MAX || months <= end - month))
+		{
+			result->lastPayment = roundToNextCent(getSegmentBalance(balance,
+				outflow, loan->monthlyRate, months - ONE) *
+				(ONE + loan->monthlyRate));
+			paid += outflow * (months - ONE) + result->lastPayment;
+			month += months;
+			break;
+		}
+		if (end == INT_MAX)
+		{
+			result->status = AMORT_PAYMENT_TOO_SMALL;
+			return result->status;
+		}
+		balance = getSegmentBalance(balance, outflow, loan->monthlyRate,
+			end - month);
+		paid += outflow * (end - month);
+		month = end;
+		if (month == lumpMonth)
+		{
+			if (balance - scenario->lumpSum < PAID_OFF)
+			{
+				//the lump sum pays off what is left
+				result->lastPayment = roundToNextCent(outflow + balance);
+				paid += result->lastPayment - outflow;
+				break;
+			}
+			balance -= scenario->lumpSum;
+			paid += scenario->lumpSum;
+		}
+	}
+	result->payoffMonth = month;
+	result->totalPaid = roundToNearestCent(paid);
+	result->totalInterest = roundToNearestCent(paid - loan->principal);
+	return AMORT_OK;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		compareToBaseline()
+//  Title:			Compare to baseline
+//	Description:	This function will fill in what a scenario saves
+//					against the level payment alone
+//	Input:			None
+//	Output:			None
+//	Calls:			roundToNearestCent()
+//	Parameters:		baseline	(const ScenarioResult*)
+//					result		(ScenarioResult*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for prepayment scenarios
+//----------------------------------------------------------------------------
+static void compareToBaseline(const ScenarioResult* baseline,
+	ScenarioResult* result)
+{
+	result->monthsSaved = 0;
+	result->interestSaved = 0.0;
+	if (result->status == AMORT_OK && baseline->status == AMORT_OK)
+	{
+		result->monthsSaved = baseline->payoffMonth - result->payoffMonth;
+		result->interestSaved = roundToNearestCent(baseline->totalInterest -
+			result->totalInterest);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runScenario()
+//  Title:			Run scenario
+//	Description:	This function will work out when a loan is paid off,
+//					and what it costs, with extra principal payments, and
+//					what that saves against the level payment alone
+//	Input:			None
+//	Output:			None
+//	Calls:			simulateScenario()
+//					compareToBaseline()
+//	Parameters:		loan		(const AmortResult*) a loan amortCalculate()
+//								finished
+//					scenario	(const PrepayScenario*)
+//					result		(ScenarioResult*)
+//  Returns:		AMORT_OK or the status left in result->status
+//	History Log:	10/17/2026 written for prepayment scenarios
+//----------------------------------------------------------------------------
+int runScenario(const AmortResult* loan, const PrepayScenario* scenario,
+	ScenarioResult* result)
+{
+	PrepayScenario none = { 0.0, 0, 0.0, 0 };
+	ScenarioResult baseline;
+	simulateScenario(loan, &none, &baseline);
+	simulateScenario(loan, scenario, result);
+	compareToBaseline(&baseline, result);
+	return result->status;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runScenarioSlice()
+//  Title:			Run scenario slice
+//	Description:	This function will run scenarios [begin, end) for one
+//					worker of runScenarioBatch()
+//	Input:			None
+//	Output:			None
+//	Calls:			simulateScenario()
+//					compareToBaseline()
+//	Parameters:		context	(void*)
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for prepayment scenarios
+//----------------------------------------------------------------------------
+static void runScenarioSlice(void* context, size_t begin, size_t end,
+	int worker)
+{
+	ScenarioJob* job = (ScenarioJob*)context;
+	size_t i = 0;
+	(void)worker;
+	for (i = begin; i < end; i++)
+	{
+		simulateScenario(job->loan, &job->scenarios[i], &job->results[i]);
+		compareToBaseline(job->baseline, &job->results[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runScenarioBatch()
+//  Title:			Run scenario batch
+//	Description:	This function will run many what-if scenarios for one
+//					loan on threadCount threads (0 for every processor).
+//					The level payment alone is worked out once for all of
+//					them, and results land at the index of their scenario
+//	Input:			None
+//	Output:			None
+//	Calls:			simulateScenario()
+//					parallelFor()
+//					runScenarioSlice()
+//	Parameters:		loan		(const AmortResult*)
+//					scenarios	(const PrepayScenario*)
+//					results		(ScenarioResult*)
+//					count		(size_t)
+//					threadCount	(int)
+//  Returns:		EXIT_SUCCESS
+//	History Log:	10/17/2026 written for prepayment scenarios
+//----------------------------------------------------------------------------
+int runScenarioBatch(const AmortResult* loan,
+	const PrepayScenario* scenarios, ScenarioResult* results, size_t count,
+	int threadCount)
+{
+	PrepayScenario none = { 0.0, 0, 0.0, 0 };
+	ScenarioResult baseline;
+	ScenarioJob job;
+
+	simulateScenario(loan, &none, &baseline);
+	job.loan = loan;
+	job.scenarios = scenarios;
+	job.results = results;
+	job.baseline = &baseline;
+	if (parallelFor(count, SCENARIO_GRAIN, threadCount, runScenarioSlice,
+		&job) != EXIT_SUCCESS)
+	{
+		runScenarioSlice(&job, 0, count, 0);
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		generateScenarioSchedule()
+//  Title:			Generate scenario schedule
+//	Description:	This function will fill the amortization table of a
+//					scenario one month at a time, for showing it; the
+//					payment column holds the level payment plus that
+//					month's extra principal
+//	Input:			None
+//	Output:			None
+//	Calls:			roundToNextCent()
+//	Parameters:		loan		(const AmortResult*)
+//					scenario	(const PrepayScenario*)
+//					rows		(ScheduleRow*)
+//					capacity	(int) rows the caller has room for
+//  Returns:		the number of rows filled, which is capacity with the
+//					last balance above 0 when the loan is not paid off by
+//					then
+//	History Log:	10/17/2026 written for prepayment scenarios
+//----------------------------------------------------------------------------
+int generateScenarioSchedule(const AmortResult* loan,
+	const PrepayScenario* scenario, ScheduleRow* rows, int capacity)
+{
+	double balance = loan->principal;
+	double interestPaid = 0.0;
+	double due = 0.0;
+	int month = 0;
+
+	if (loan->status != AMORT_OK)
+	{
+		return ZERO;
+	}
+	for (month = 1; month <= capacity; month++)
+	{
+		interestPaid = balance * loan->monthlyRate;
+		due = loan->payment;
+		if (scenario->extraMonthly > ZERO && month >= scenario->extraStart)
+		{
+			due += scenario->extraMonthly;
+		}
+		if (scenario->lumpSum > ZERO && month == scenario->lumpMonth)
+		{
+			due += scenario->lumpSum;
+		}
+		rows[month - ONE].month = month;
+		rows[month - ONE].interestPaid = interestPaid;
+		if (balance + interestPaid - due < PAID_OFF)
+		{
+			rows[month - ONE].payment = roundToNextCent(balance +
+				interestPaid);
+			rows[month - ONE].principalPaid = balance;
+			rows[month - ONE].balance = 0;
+			return month;
+		}
+		rows[month - ONE].payment = due;
+		rows[month - ONE].principalPaid = due - interestPaid;
+		balance -= due - interestPaid;
+		rows[month - ONE].balance = balance;
+	}
+	return capacity;
+}
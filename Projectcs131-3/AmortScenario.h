@@ -0,0 +1,47 @@
+#ifndef AMORTSCENARIO_H
+#define AMORTSCENARIO_H
+#include <stddef.h>
+#include "AmortApi.h"
+#define SCENARIO_GRAIN 64
+#define NEVER -1
+#define PAID_OFF 0.005
+//----------------------------------------------------------------------------
+// PrepayScenario: principal paid on top of the level payment
+//		extraMonthly	paid every month from extraStart on
+//		lumpSum			paid once with the payment of lumpMonth; a
+//						lumpMonth of 0 means none
+//----------------------------------------------------------------------------
+typedef struct PrepayScenario {
+	double extraMonthly;
+	int extraStart;
+	double lumpSum;
+	int lumpMonth;
+} PrepayScenario;
+//----------------------------------------------------------------------------
+// ScenarioResult: how a loan ends under a scenario
+//		status			AMORT_OK, the loan's own status, or
+//						AMORT_BAD_PAYMENT for a negative extra payment
+//		payoffMonth		month of the last payment
+//		lastPayment		what that month's payment comes to
+//		monthsSaved, interestSaved	against the level payment alone
+//----------------------------------------------------------------------------
+typedef struct ScenarioResult {
+	int status;
+	int payoffMonth;
+	int monthsSaved;
+	double lastPayment;
+	double totalPaid;
+	double totalInterest;
+	double interestSaved;
+} ScenarioResult;
+double getSegmentBalance(double balance, double outflow,
+	double monthlyRate, int months);
+int getMonthsToPayoff(double balance, double outflow, double monthlyRate);
+int runScenario(const AmortResult* loan, const PrepayScenario* scenario,
+	ScenarioResult* result);
+int runScenarioBatch(const AmortResult* loan,
+	const PrepayScenario* scenarios, ScenarioResult* results, size_t count,
+	int threadCount);
+int generateScenarioSchedule(const AmortResult* loan,
+	const PrepayScenario* scenario, ScheduleRow* rows, int capacity);
+#endif
@@ -0,0 +1,276 @@
+#include "AmortSchedule.h"
+#include "AmortGrowth.h"
+#include <float.h>
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define HUNDRED 100
+#define SAFETY 8
+//the standard terms generateSchedule() has a fixed-term kernel for
+#define STANDARD_TERMS(KERNEL) \
+	KERNEL(36) KERNEL(48) KERNEL(60) KERNEL(72) KERNEL(180) KERNEL(360)
+
+//----------------------------------------------------------------------------
+//	Function:		nextPayment()
+//  Title:			Next payment
+//	Description:	This function will give the same payment as
+//					getPaymentAmount(months, balance, monthlyRate) from a
+//					growth factor (1 + monthlyRate)^months that was carried
+//					from row to row instead of calling pow(). When the
+//					payment in cents lies so close to a whole cent that the
+//					carried factor's error could move ceil() to the other
+//					side, getPaymentAmount() is called after all
+//	Input:			None
+//	Output:			None
+//	Calls:			getPaymentAmount()
+//	Parameters:		months		(int)
+//					balance		(double)
+//					monthlyRate	(double)
+//					growth		(double)
+//					steps		(int) divisions the growth factor went through
+//  Returns:		the payment rounded to the next cent
+//	History Log:	10/17/2026 written for the incremental schedule
+//----------------------------------------------------------------------------
+static double nextPayment(int months, double balance, double monthlyRate,
+	double growth, int steps)
+{
+	double cents = growth * balance * monthlyRate / (growth - ONE) * HUNDRED;
+	double error = fabs(cents) * (steps + SAFETY) * DBL_EPSILON *
+		growth / (growth - ONE);
+	double whole = ceil(cents);
+	if (whole - cents <= error || cents - (whole - ONE) <= error)
+	{
+		return getPaymentAmount(months, balance, monthlyRate);
+	}
+	return whole / HUNDRED;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		initScheduleCursor()
+//  Title:			Initialize schedule cursor
+//	Description:	This function will set a cursor at the first month of a
+//					loan's amortization table. Rows are then pulled one at
+//					a time with nextScheduleRow(), so a caller walking many
+//					loans needs room for one row, not a whole table
+//	Input:			None
+//	Output:			None
+//	Calls:			findGrowthRow()
+//	Parameters:		cursor		(ScheduleCursor*)
+//					principal	(double)
+//					payment		(double)
+//					monthlyRate	(double)
+//					months		(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the schedule cursor
+//----------------------------------------------------------------------------
+void initScheduleCursor(ScheduleCursor* cursor, double principal,
+	double payment, double monthlyRate, int months)
+{
+	cursor->balance = principal;
+	cursor->payment = payment;
+	cursor->monthlyRate = monthlyRate;
+	cursor->base = ONE + monthlyRate;
+	cursor->growth = 0.0;
+	cursor->growthRow = NULL;
+	cursor->months = months;
+	cursor->row = 0;
+	if (months <= ZERO || monthlyRate == ZERO)
+	{
+		return;
+	}
+	if (months <= GROWTH_MAX_MONTHS)
+	{
+		cursor->growthRow = findGrowthRow(monthlyRate);
+	}
+	if (cursor->growthRow == NULL)
+	{
+		cursor->growth = pow(cursor->base, months);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		nextScheduleRow()
+//  Title:			Next schedule row
+//	Description:	This function will work out the next month of the
+//					table. Each month's payment is still the level payment
+//					for the balance and months left, but (1 + monthlyRate)^i
+//					is read from the growth table, or carried down one
+//					division per row when the rate is not in it, instead of
+//					two pow() calls, so the numbers are the same as before
+//					at a fraction of the cost
+//	Input:			None
+//	Output:			None
+//	Calls:			nextPayment()
+//					roundToNextCent()
+//	Parameters:		cursor	(ScheduleCursor*)
+//					row		(ScheduleRow*)
+//  Returns:		TRUE when row was filled, FALSE after the last month
+//	History Log:	10/17/2026 written for the schedule cursor
+//					10/17/2026 moved out of generateSchedule()
+//----------------------------------------------------------------------------
+int nextScheduleRow(ScheduleCursor* cursor, ScheduleRow* row)
+{
+	int i = cursor->months - cursor->row;
+	double tabPayment = cursor->payment;
+	double interestPaid = 0.0;
+	double principalPaid = cursor->payment;
+
+	if (i <= ZERO)
+	{
+		return FALSE;
+	}
+	if (cursor->monthlyRate == ZERO)
+	{
+		if (i > ONE)
+		{
+			cursor->balance -= principalPaid;
+		}
+		else
+		{
+			principalPaid = cursor->balance;
+			tabPayment = cursor->balance;
+			cursor->balance = 0;
+		}
+	}
+	else if (i > ONE && cursor->growthRow != NULL)
+	{
+		//the table holds the exact factor getPaymentAmount() uses
+		cursor->growth = cursor->growthRow[i];
+		tabPayment = roundToNextCent(cursor->growth * cursor->balance *
+			cursor->monthlyRate / (cursor->growth - ONE));
+		interestPaid = cursor->balance * cursor->monthlyRate;
+		principalPaid = tabPayment - interestPaid;
+		cursor->balance -= principalPaid;
+	}
+	else if (i > ONE)
+	{
+		tabPayment = nextPayment(i, cursor->balance, cursor->monthlyRate,
+			cursor->growth, cursor->row);
+		interestPaid = cursor->balance * cursor->monthlyRate;
+		principalPaid = tabPayment - interestPaid;
+		cursor->balance -= principalPaid;
+		cursor->growth /= cursor->base;
+	}
+	else
+	{
+		interestPaid = cursor->balance * cursor->monthlyRate;
+		principalPaid = cursor->balance;
+		tabPayment = roundToNextCent(principalPaid + interestPaid);
+		cursor->balance = 0;
+	}
+	cursor->row++;
+	row->month = cursor->row;
+	row->payment = tabPayment;
+	row->principalPaid = principalPaid;
+	row->interestPaid = interestPaid;
+	row->balance = cursor->balance;
+	return TRUE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		generateSchedule36() ... generateSchedule360()
+//  Title:			Generate fixed-term schedule
+//	Description:	SCHEDULE_KERNEL(term) defines the function that fills
+//					the table of a term-month loan whose rate is in the
+//					growth table. It does what the growth-table branch of
+//					nextScheduleRow() does, in the same order so the
+//					numbers are the same to the bit, but with the trip
+//					count a constant, no cursor, no per-row test of which
+//					branch applies and roundToNextCent() written out in
+//					place, so nothing but the arithmetic is left in the
+//					loop
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		balance		(double) the principal
+//					monthlyRate	(double)
+//					growthRow	(const double*) the growth table's row for
+//								the rate
+//					rows		(ScheduleRow*) room for term rows
+//  Returns:		term, the number of rows filled
+//	History Log:	10/17/2026 written for the fixed-term kernels
+//----------------------------------------------------------------------------
+#define SCHEDULE_KERNEL(term) \
+static int generateSchedule##term(double balance, double monthlyRate, \
+	const double* growthRow, ScheduleRow* rows) \
+{ \
+	double growth = 0.0; \
+	double tabPayment = 0.0; \
+	double interestPaid = 0.0; \
+	double principalPaid = 0.0; \
+	int row = 0; \
+\
+	for (row = 0; row < term - ONE; row++) \
+	{ \
+		growth = growthRow[term - row]; \
+		tabPayment = ceil(growth * balance * monthlyRate / (growth - ONE) * \
+			HUNDRED) / HUNDRED; \
+		interestPaid = balance * monthlyRate; \
+		principalPaid = tabPayment - interestPaid; \
+		balance -= principalPaid; \
+		rows[row].month = row + ONE; \
+		rows[row].payment = tabPayment; \
+		rows[row].principalPaid = principalPaid; \
+		rows[row].interestPaid = interestPaid; \
+		rows[row].balance = balance; \
+	} \
+	interestPaid = balance * monthlyRate; \
+	rows[row].month = term; \
+	rows[row].payment = ceil((balance + interestPaid) * HUNDRED) / HUNDRED; \
+	rows[row].principalPaid = balance; \
+	rows[row].interestPaid = interestPaid; \
+	rows[row].balance = 0; \
+	return term; \
+}
+
+STANDARD_TERMS(SCHEDULE_KERNEL)
+#define SCHEDULE_CASE(term) \
+	case term: \
+		return generateSchedule##term(principal, monthlyRate, \
+			cursor.growthRow, rows);
+
+//----------------------------------------------------------------------------
+//	Function:		generateSchedule()
+//  Title:			Generate schedule
+//	Description:	This function will fill rows[0 .. months - 1] with the
+//					amortization table printTable() writes, pulling every
+//					row from a ScheduleCursor. A standard term at a rate in
+//					the growth table goes to its fixed-term kernel instead
+//	Input:			None
+//	Output:			None
+//	Calls:			initScheduleCursor()
+//					nextScheduleRow()
+//					generateSchedule36() ... generateSchedule360()
+//	Parameters:		principal	(double)
+//					payment		(double)
+//					monthlyRate	(double)
+//					months		(int)
+//					rows		(ScheduleRow*) room for months rows
+//  Returns:		the number of rows filled
+//	History Log:	10/17/2026 written for the incremental schedule
+//					10/17/2026 rows come from nextScheduleRow()
+//					10/17/2026 standard terms go to a fixed-term kernel
+//----------------------------------------------------------------------------
+int generateSchedule(double principal, double payment, double monthlyRate,
+	int months, ScheduleRow* rows)
+{
+	ScheduleCursor cursor;
+	int count = 0;
+
+	initScheduleCursor(&cursor, principal, payment, monthlyRate, months);
+	if (cursor.growthRow != NULL)
+	{
+		switch (months)
+		{
+		STANDARD_TERMS(SCHEDULE_CASE)
+		default:
+			break;
+		}
+	}
+	while (nextScheduleRow(&cursor, &rows[count]))
+	{
+		count++;
+	}
+	return count;
+}
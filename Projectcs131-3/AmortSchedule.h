@@ -0,0 +1,37 @@
+#ifndef AMORTSCHEDULE_H
+#define AMORTSCHEDULE_H
+#include "Amort.h"
+//----------------------------------------------------------------------------
+// ScheduleRow: one line of the amortization table
+//----------------------------------------------------------------------------
+typedef struct ScheduleRow {
+	int month;
+	double payment;
+	double principalPaid;
+	double interestPaid;
+	double balance;
+} ScheduleRow;
+//----------------------------------------------------------------------------
+// ScheduleCursor: where nextScheduleRow() is in a loan's table
+//		balance		what is owed before the next row
+//		growth		(1 + monthlyRate)^(months left), carried from row to
+//					row when growthRow is NULL
+//		growthRow	the growth table's row for the rate, or NULL
+//		row			rows handed out so far
+//----------------------------------------------------------------------------
+typedef struct ScheduleCursor {
+	double balance;
+	double payment;
+	double monthlyRate;
+	double base;
+	double growth;
+	const double* growthRow;
+	int months;
+	int row;
+} ScheduleCursor;
+int generateSchedule(double principal, double payment, double monthlyRate,
+	int months, ScheduleRow* rows);
+void initScheduleCursor(ScheduleCursor* cursor, double principal,
+	double payment, double monthlyRate, int months);
+int nextScheduleRow(ScheduleCursor* cursor, ScheduleRow* row);
+#endif
@@ -0,0 +1,787 @@
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+#include "AmortServer.h"
+#include "AmortBatch.h"
+#include "AmortReader.h"
+#include "AmortCache.h"
+#include "AmortWriter.h"
+#include "AmortParallel.h"
+#include "AmortThread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#ifdef __linux__
+#include <errno.h>
+#include <netdb.h>
+#include <signal.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define NOT_ROOM -1
+#define ROW_MAX (5 * WRITER_MONEY_MAX + 16)
+#define UNIX_PREFIX "unix:"
+#define UNIX_PREFIX_LENGTH 5
+
+//----------------------------------------------------------------------------
+//	Function:		answerSchedule()
+//  Title:			Answer schedule
+//	Description:	This function will write the answer to an S request: the
+//					loan line as a P request would get it, then one line
+//					"month,payment,principal paid,interest paid,balance" per
+//					row of its amortization table
+//	Input:			None
+//	Output:			None
+//	Calls:			amortSchedule()
+//					formatMoney()
+//	Parameters:		loan	(const AmortResult*)
+//					out		(char*)
+//					size	(size_t)
+//  Returns:		the length of the answer, or -1 when size is too small
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static int answerSchedule(const AmortResult* loan, char* out, size_t size)
+{
+	ScheduleRow rows[AMORT_MAX_MONTHS];
+	char* cursor = out;
+	int count = 0;
+	int written = 0;
+	int i = 0;
+
+	written = snprintf(out, size, "S,%.3lf,%.2lf,%.2lf,%d\n", loan->apr,
+		loan->principal, loan->payment, loan->months);
+	if (written < ZERO || (size_t)written >= size)
+	{
+		return NOT_ROOM;
+	}
+	cursor += written;
+	amortSchedule(loan, rows, AMORT_MAX_MONTHS, &count);
+	for (i = 0; i < count; i++)
+	{
+		if ((size_t)(out + size - cursor) < ROW_MAX)
+		{
+			return NOT_ROOM;
+		}
+		cursor += sprintf(cursor, "%d,", rows[i].month);
+		cursor = formatMoney(cursor, rows[i].payment);
+		*cursor++ = ',';
+		cursor = formatMoney(cursor, rows[i].principalPaid);
+		*cursor++ = ',';
+		cursor = formatMoney(cursor, rows[i].interestPaid);
+		*cursor++ = ',';
+		cursor = formatMoney(cursor, rows[i].balance);
+		*cursor++ = '\n';
+	}
+	return (int)(cursor - out);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		answerRequest()
+//  Title:			Answer request
+//	Description:	This function will answer one line of the server
+//					protocol. "mode,apr,principal,payment,months" with mode
+//					P, L, N or I (or 1 to 4) is answered exactly like the
+//					same line in a batch file. Mode S calculates the payment
+//					like P and adds the amortization table. The line is
+//					read by parseLoanLine(), the batch file reader, so a
+//					number it does not take, such as "inf", "nan" or hex,
+//					makes the line unreadable. A line that cannot be read
+//					is answered "?,ERROR"
+//	Input:			None
+//	Output:			None
+//	Calls:			parseLoanLine()
+//					getLoanRequest()
+//					cachedCalculate()
+//					formatLoanResult()
+//					answerSchedule()
+//	Parameters:		line	(const char*) one request without its newline
+//					out		(char*)
+//					size	(size_t)
+//  Returns:		the length of the answer, or -1 when size is too small
+//	History Log:	10/17/2026 written for the pricing server
+//					10/17/2026 answers come through the quote cache
+//					10/17/2026 read by parseLoanLine()
+//----------------------------------------------------------------------------
+int answerRequest(const char* line, char* out, size_t size)
+{
+	char copy[SERVER_LINE_MAX];
+	const char* start = line;
+	LoanLine loanLine;
+	LoanResult result;
+	AmortRequest request;
+	AmortResult loan;
+	int schedule = FALSE;
+	int written = 0;
+
+	while (isspace((unsigned char)*start))
+	{
+		start++;
+	}
+	if ((*start == 'S' || *start == 's') && strlen(start) < SERVER_LINE_MAX)
+	{
+		//read it as the P request it is apart from the table
+		strcpy(copy, start);
+		copy[ZERO] = 'P';
+		start = copy;
+		schedule = TRUE;
+	}
+	if (parseLoanLine(start, start + strlen(start), &loanLine) ==
+		AMORT_BAD_FORMAT)
+	{
+		written = snprintf(out, size, "?,ERROR\n");
+	}
+	else
+	{
+		getLoanRequest(&loanLine, &request);
+		loan.status = loanLine.status;
+		if (loan.status == AMORT_OK)
+		{
+			cachedCalculate(&request, &loan);
+		}
+		if (schedule && loan.status != AMORT_OK)
+		{
+			written = snprintf(out, size, "S,ERROR\n");
+		}
+		else if (schedule)
+		{
+			return answerSchedule(&loan, out, size);
+		}
+		else
+		{
+			//what priceLoan() hands a batch file
+			result.status = BATCH_INVALID;
+			if (loan.status == AMORT_OK)
+			{
+				result.status = BATCH_OK;
+				result.apr = loan.apr;
+				result.principal = loan.principal;
+				result.payment = loan.payment;
+				result.months = loan.months;
+			}
+			written = formatLoanResult(loanLine.mode, &result, out, size);
+		}
+	}
+	if (written < ZERO || (size_t)written >= size)
+	{
+		return NOT_ROOM;
+	}
+	return written;
+}
+
+#ifdef __linux__
+//----------------------------------------------------------------------------
+// Connection: one client socket and what is waiting to be read or sent
+//		readClosed	TRUE once the client has shut down its side; the
+//					connection stays open until every answer is sent
+//		previous, next	the worker's other open connections
+//----------------------------------------------------------------------------
+typedef struct Connection {
+	struct Connection* previous;
+	struct Connection* next;
+	int socket;
+	int waitingToSend;
+	int readClosed;
+	size_t inUsed;
+	size_t outUsed;
+	size_t outSent;
+	size_t outCapacity;
+	char* out;
+	char in[SERVER_READ_SIZE];
+} Connection;
+//----------------------------------------------------------------------------
+// ServerWorker: one event loop; every worker accepts from the same socket
+//		connections	the clients it serves, closed when it stops
+//----------------------------------------------------------------------------
+typedef struct ServerWorker {
+	int listener;
+	int status;
+	Connection* connections;
+} ServerWorker;
+
+static volatile sig_atomic_t serverStopping = FALSE;
+
+//----------------------------------------------------------------------------
+//	Function:		stopServer()
+//  Title:			Stop server
+//	Description:	This function will ask every event loop to finish when
+//					SIGINT or SIGTERM arrives
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		signalNumber	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static void stopServer(int signalNumber)
+{
+	(void)signalNumber;
+	serverStopping = TRUE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		closeConnection()
+//  Title:			Close connection
+//	Description:	This function will close a client socket, take it off
+//					the worker's list and free it
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		worker		(ServerWorker*)
+//					connection	(Connection*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the pricing server
+//					10/17/2026 taken off the worker's list
+//----------------------------------------------------------------------------
+static void closeConnection(ServerWorker* worker, Connection* connection)
+{
+	if (connection->previous != NULL)
+	{
+		connection->previous->next = connection->next;
+	}
+	else
+	{
+		worker->connections = connection->next;
+	}
+	if (connection->next != NULL)
+	{
+		connection->next->previous = connection->previous;
+	}
+	close(connection->socket);
+	free(connection->out);
+	free(connection);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		watchConnection()
+//  Title:			Watch connection
+//	Description:	This function will have the event loop wait for the
+//					socket to take more output while answers are left
+//					unsent, and for more requests otherwise
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		poller		(int) the worker's epoll descriptor
+//					connection	(Connection*)
+//					sending		(int) TRUE while output is waiting
+//  Returns:		void
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static void watchConnection(int poller, Connection* connection, int sending)
+{
+	struct epoll_event event;
+	if (connection->waitingToSend == sending)
+	{
+		return;
+	}
+	event.events = sending ? EPOLLOUT : EPOLLIN;
+	event.data.ptr = connection;
+	epoll_ctl(poller, EPOLL_CTL_MOD, connection->socket, &event);
+	connection->waitingToSend = sending;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		sendAnswers()
+//  Title:			Send answers
+//	Description:	This function will send as much of the waiting output
+//					as the socket takes without blocking. A client that has
+//					stopped sending is done once it has every answer
+//	Input:			None
+//	Output:			the answers to the client
+//	Calls:			watchConnection()
+//	Parameters:		poller		(int)
+//					connection	(Connection*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the client is gone or
+//					has stopped sending and has every answer, so the
+//					connection has to be closed
+//	History Log:	10/17/2026 written for the pricing server
+//					10/17/2026 done once a read-closed client has it all
+//----------------------------------------------------------------------------
+static int sendAnswers(int poller, Connection* connection)
+{
+	ssize_t sent = 0;
+	while (connection->outSent < connection->outUsed)
+	{
+		sent = send(connection->socket, connection->out + connection->outSent,
+			connection->outUsed - connection->outSent, MSG_NOSIGNAL);
+		if (sent < ZERO)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+			{
+				return EXIT_FAILURE;
+			}
+			break;
+		}
+		connection->outSent += (size_t)sent;
+	}
+	if (connection->outSent == connection->outUsed)
+	{
+		if (connection->readClosed)
+		{
+			return EXIT_FAILURE;
+		}
+		connection->outSent = 0;
+		connection->outUsed = 0;
+	}
+	watchConnection(poller, connection,
+		connection->outUsed > connection->outSent);
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		queueAnswer()
+//  Title:			Queue answer
+//	Description:	This function will append the answer to one request to
+//					the connection's output, growing it when the answer
+//					does not fit
+//	Input:			None
+//	Output:			None
+//	Calls:			answerRequest()
+//	Parameters:		connection	(Connection*)
+//					line		(const char*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when memory runs out
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static int queueAnswer(Connection* connection, const char* line)
+{
+	char* grown = NULL;
+	size_t capacity = 0;
+	int written = NOT_ROOM;
+	while (TRUE)
+	{
+		if (connection->out != NULL)
+		{
+			written = answerRequest(line, connection->out + connection->outUsed,
+				connection->outCapacity - connection->outUsed);
+		}
+		if (written != NOT_ROOM)
+		{
+			connection->outUsed += (size_t)written;
+			return EXIT_SUCCESS;
+		}
+		capacity = connection->outCapacity == ZERO ? SERVER_READ_SIZE :
+			connection->outCapacity * 2;
+		grown = realloc(connection->out, capacity);
+		if (grown == NULL)
+		{
+			return EXIT_FAILURE;
+		}
+		connection->out = grown;
+		connection->outCapacity = capacity;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readRequests()
+//  Title:			Read requests
+//	Description:	This function will read what the client sent, answer
+//					every complete line in order and send the answers.
+//					Requests may be pipelined: a client can send many lines
+//					before reading any answer. Once SERVER_OUT_LIMIT bytes
+//					of answers wait for a slow client, reading stops until
+//					they are sent. When the client shuts down its side the
+//					answers already queued are still sent before the
+//					connection is closed
+//	Input:			requests from the client
+//	Output:			None
+//	Calls:			queueAnswer()
+//					sendAnswers()
+//	Parameters:		poller		(int)
+//					connection	(Connection*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the connection has
+//					to be closed
+//	History Log:	10/17/2026 written for the pricing server
+//					10/17/2026 answers flushed after the client's EOF
+//----------------------------------------------------------------------------
+static int readRequests(int poller, Connection* connection)
+{
+	ssize_t received = 0;
+	char* line = NULL;
+	char* newline = NULL;
+	char* end = NULL;
+	size_t left = 0;
+
+	while (!connection->readClosed &&
+		connection->outUsed - connection->outSent < SERVER_OUT_LIMIT)
+	{
+		received = recv(connection->socket, connection->in +
+			connection->inUsed, SERVER_READ_SIZE - connection->inUsed, ZERO);
+		if (received == ZERO)
+		{
+			//nothing more is coming, but what was asked is still owed
+			connection->readClosed = TRUE;
+			break;
+		}
+		if (received < ZERO)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+			{
+				return EXIT_FAILURE;
+			}
+			break;
+		}
+		connection->inUsed += (size_t)received;
+		line = connection->in;
+		end = connection->in + connection->inUsed;
+		while ((newline = memchr(line, '\n', end - line)) != NULL)
+		{
+			*newline = '\0';
+			if (newline > line && newline[-ONE] == '\r')
+			{
+				newline[-ONE] = '\0';
+			}
+			if (newline - line >= SERVER_LINE_MAX)
+			{
+				strcpy(line, "?");
+			}
+			//blank lines get no answer, as in batch files
+			if (line[strspn(line, " \t")] != '\0' &&
+				queueAnswer(connection, line) != EXIT_SUCCESS)
+			{
+				return EXIT_FAILURE;
+			}
+			line = newline + ONE;
+		}
+		left = end - line;
+		if (left == SERVER_READ_SIZE)
+		{
+			//a line longer than the whole buffer is not a request
+			return EXIT_FAILURE;
+		}
+		memmove(connection->in, line, left);
+		connection->inUsed = left;
+	}
+	return sendAnswers(poller, connection);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		acceptClients()
+//  Title:			Accept clients
+//	Description:	This function will accept every waiting client and add
+//					it to this worker's event loop and list
+//	Input:			None
+//	Output:			None
+//	Calls:			closeConnection()
+//	Parameters:		worker	(ServerWorker*)
+//					poller	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the pricing server
+//					10/17/2026 connections listed on the worker
+//----------------------------------------------------------------------------
+static void acceptClients(ServerWorker* worker, int poller)
+{
+	struct epoll_event event;
+	Connection* connection = NULL;
+	int client = 0;
+	int on = ONE;
+	while ((client = accept4(worker->listener, NULL, NULL,
+		SOCK_NONBLOCK | SOCK_CLOEXEC)) >= ZERO)
+	{
+		//answers are small and must not wait for Nagle's timer
+		setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+		connection = malloc(sizeof(Connection));
+		if (connection == NULL)
+		{
+			close(client);
+			continue;
+		}
+		memset(connection, ZERO, offsetof(Connection, in));
+		connection->socket = client;
+		connection->next = worker->connections;
+		if (worker->connections != NULL)
+		{
+			worker->connections->previous = connection;
+		}
+		worker->connections = connection;
+		event.events = EPOLLIN;
+		event.data.ptr = connection;
+		if (epoll_ctl(poller, EPOLL_CTL_ADD, client, &event) != ZERO)
+		{
+			closeConnection(worker, connection);
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		serveEvents()
+//  Title:			Serve events
+//	Description:	This function will run one worker's event loop until
+//					the server is stopped. Every worker waits on the shared
+//					listening socket with EPOLLEXCLUSIVE, so a new client
+//					wakes one worker, and that worker alone serves it from
+//					then on without any lock. Clients still connected when
+//					the server stops are closed
+//	Input:			None
+//	Output:			None
+//	Calls:			acceptClients()
+//					readRequests()
+//					sendAnswers()
+//					closeConnection()
+//	Parameters:		argument	(void*) the ServerWorker
+//  Returns:		void
+//	History Log:	10/17/2026 written for the pricing server
+//					10/17/2026 open connections closed on the way out
+//----------------------------------------------------------------------------
+static void serveEvents(void* argument)
+{
+	ServerWorker* worker = argument;
+	struct epoll_event events[SERVER_EVENTS];
+	struct epoll_event event;
+	Connection* connection = NULL;
+	int poller = epoll_create1(EPOLL_CLOEXEC);
+	int ready = 0;
+	int result = 0;
+	int i = 0;
+
+	worker->status = EXIT_FAILURE;
+	worker->connections = NULL;
+	event.events = EPOLLIN | EPOLLEXCLUSIVE;
+	event.data.ptr = NULL;
+	if (poller < ZERO ||
+		epoll_ctl(poller, EPOLL_CTL_ADD, worker->listener, &event) != ZERO)
+	{
+		if (poller >= ZERO)
+		{
+			close(poller);
+		}
+		return;
+	}
+	worker->status = EXIT_SUCCESS;
+	while (!serverStopping)
+	{
+		ready = epoll_wait(poller, events, SERVER_EVENTS, SERVER_POLL_MS);
+		for (i = 0; i < ready; i++)
+		{
+			connection = events[i].data.ptr;
+			if (connection == NULL)
+			{
+				acceptClients(worker, poller);
+				continue;
+			}
+			if (events[i].events & (EPOLLERR | EPOLLHUP))
+			{
+				result = EXIT_FAILURE;
+			}
+			else if (events[i].events & EPOLLOUT)
+			{
+				result = sendAnswers(poller, connection);
+				if (result == EXIT_SUCCESS && !connection->waitingToSend)
+				{
+					//pick up requests held back while output was full
+					result = readRequests(poller, connection);
+				}
+			}
+			else
+			{
+				result = readRequests(poller, connection);
+			}
+			if (result != EXIT_SUCCESS)
+			{
+				closeConnection(worker, connection);
+			}
+		}
+	}
+	while (worker->connections != NULL)
+	{
+		closeConnection(worker, worker->connections);
+	}
+	close(poller);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		openListener()
+//  Title:			Open listener
+//	Description:	This function will open the non-blocking listening
+//					socket for "unix:path" or "host:port" (":port" listens on
+//					every address)
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		address	(const char*)
+//  Returns:		the socket, or -1 when it cannot be opened
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+static int openListener(const char* address)
+{
+	struct sockaddr_un local;
+	struct addrinfo hints;
+	struct addrinfo* found = NULL;
+	char host[SERVER_LINE_MAX];
+	const char* colon = strrchr(address, ':');
+	int listener = -ONE;
+	int on = ONE;
+
+	if (strncmp(address, UNIX_PREFIX, UNIX_PREFIX_LENGTH) == ZERO)
+	{
+		memset(&local, ZERO, sizeof(local));
+		local.sun_family = AF_UNIX;
+		if (strlen(address + UNIX_PREFIX_LENGTH) >= sizeof(local.sun_path))
+		{
+			return -ONE;
+		}
+		strcpy(local.sun_path, address + UNIX_PREFIX_LENGTH);
+		unlink(local.sun_path);
+		listener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+			ZERO);
+		if (listener < ZERO || bind(listener, (struct sockaddr*)&local,
+			sizeof(local)) != ZERO || listen(listener, SERVER_BACKLOG) != ZERO)
+		{
+			if (listener >= ZERO)
+			{
+				close(listener);
+			}
+			return -ONE;
+		}
+		return listener;
+	}
+	if (colon == NULL || (size_t)(colon - address) >= sizeof(host))
+	{
+		return -ONE;
+	}
+	memcpy(host, address, colon - address);
+	host[colon - address] = '\0';
+	memset(&hints, ZERO, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_flags = AI_PASSIVE;
+	if (getaddrinfo(host[ZERO] != '\0' ? host : NULL, colon + ONE, &hints,
+		&found) != ZERO)
+	{
+		return -ONE;
+	}
+	listener = socket(found->ai_family,
+		found->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, found->ai_protocol);
+	if (listener >= ZERO)
+	{
+		setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+		if (bind(listener, found->ai_addr, found->ai_addrlen) != ZERO ||
+			listen(listener, SERVER_BACKLOG) != ZERO)
+		{
+			close(listener);
+			listener = -ONE;
+		}
+	}
+	freeaddrinfo(found);
+	return listener;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runServer()
+//  Title:			Run server
+//	Description:	This function will serve the line protocol of
+//					answerRequest() on address until SIGINT or SIGTERM, with
+//					one event loop per thread; the calling thread runs the
+//					first one
+//	Input:			requests from clients
+//	Output:			answers to clients, errors to stderr
+//	Calls:			openListener()
+//					initQuoteCache()
+//					getThreadCount()
+//					createThread()
+//					serveEvents()
+//					joinThread()
+//					getQuoteCacheStats()
+//	Parameters:		address		(const char*) "unix:path" or "host:port"
+//					threadCount	(int) 0 for every processor
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the server cannot start
+//	History Log:	10/17/2026 written for the pricing server
+//					10/17/2026 quote cache set up and its counters reported
+//----------------------------------------------------------------------------
+int runServer(const char* address, int threadCount)
+{
+	ServerWorker workers[MAX_THREADS];
+	AmortThread threads[MAX_THREADS];
+	QuoteCacheStats cache;
+	struct sigaction action;
+	int listener = openListener(address);
+	int started = 0;
+	int status = EXIT_SUCCESS;
+	int i = 0;
+
+	if (listener < ZERO)
+	{
+		fprintf(stderr, "Could not listen on %s.\n", address);
+		return EXIT_FAILURE;
+	}
+	memset(&action, ZERO, sizeof(action));
+	action.sa_handler = stopServer;
+	sigaction(SIGINT, &action, NULL);
+	sigaction(SIGTERM, &action, NULL);
+	signal(SIGPIPE, SIG_IGN);
+	initQuoteCache();
+	threadCount = getThreadCount(threadCount);
+	for (i = 0; i < threadCount; i++)
+	{
+		workers[i].listener = listener;
+		workers[i].status = EXIT_SUCCESS;
+	}
+	fprintf(stderr, "Listening on %s with %d threads.\n", address,
+		threadCount);
+	for (started = 1; started < threadCount; started++)
+	{
+		if (createThread(&threads[started], serveEvents,
+			&workers[started]) != EXIT_SUCCESS)
+		{
+			break;
+		}
+	}
+	serveEvents(&workers[ZERO]);
+	for (i = 1; i < started; i++)
+	{
+		joinThread(threads[i]);
+	}
+	for (i = 0; i < started; i++)
+	{
+		if (workers[i].status != EXIT_SUCCESS)
+		{
+			status = EXIT_FAILURE;
+		}
+	}
+	getQuoteCacheStats(&cache);
+	fprintf(stderr, "Quote cache: %lld hits, %lld misses, %lld evictions, "
+		"%lld uncached, %d held.\n", cache.hits, cache.misses,
+		cache.evictions, cache.bypassed, cache.entries);
+	close(listener);
+	if (strncmp(address, UNIX_PREFIX, UNIX_PREFIX_LENGTH) == ZERO)
+	{
+		unlink(address + UNIX_PREFIX_LENGTH);
+	}
+	return status;
+}
+#else
+//----------------------------------------------------------------------------
+//	Function:		runServer()
+//  Title:			Run server
+//	Description:	This function will report that server mode needs the
+//					Linux event loop
+//	Input:			None
+//	Output:			an error to stderr
+//	Calls:			None
+//	Parameters:		address		(const char*)
+//					threadCount	(int)
+//  Returns:		EXIT_FAILURE
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+int runServer(const char* address, int threadCount)
+{
+	(void)threadCount;
+	fprintf(stderr, "Server mode on %s needs Linux.\n", address);
+	return EXIT_FAILURE;
+}
+#endif
@@ -0,0 +1,12 @@
+#ifndef AMORTSERVER_H
+#define AMORTSERVER_H
+#include "AmortApi.h"
+#define SERVER_LINE_MAX 256
+#define SERVER_READ_SIZE 65536
+#define SERVER_OUT_LIMIT (1 << 20)
+#define SERVER_BACKLOG 1024
+#define SERVER_EVENTS 256
+#define SERVER_POLL_MS 200
+int answerRequest(const char* line, char* out, size_t size);
+int runServer(const char* address, int threadCount);
+#endif
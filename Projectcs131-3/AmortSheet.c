@@ -0,0 +1,275 @@
+#include "AmortSheet.h"
+#include "AmortCents.h"
+#include "AmortParallel.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#define ONE 1
+#define ZERO 0
+#define HUNDRED 100
+#define EIGHTHS_PER_POINT 8
+#define MONTHPERCENT 1200
+#define GUARD 1e-9
+
+//----------------------------------------------------------------------------
+//	Function:		buildSheetRows()
+//  Title:			Build sheet rows
+//	Description:	This function will fill APR rows [begin, end) for one
+//					worker of buildRateSheet(). Along a row the growth
+//					factor (1 + r)^n is carried from term to term with one
+//					multiplication instead of a pow() per cell. It drifts a
+//					few ulps from the one getPaymentAmount() uses, which
+//					can only matter when the payment lands within a
+//					billionth of a whole cent; those cells, and the 0%
+//					row, are handed to getPaymentAmount() itself
+//	Input:			None
+//	Output:			None
+//	Calls:			getPaymentAmount()
+//					toCents()
+//	Parameters:		context	(void*) the RateSheet
+//					begin	(size_t)
+//					end		(size_t)
+//					worker	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the rate sheet
+//----------------------------------------------------------------------------
+static void buildSheetRows(void* context, size_t begin, size_t end,
+	int worker)
+{
+	RateSheet* sheet = (RateSheet*)context;
+	double principal = (double)sheet->principalCents / HUNDRED;
+	double monthlyRate = 0.0;
+	double growth = 0.0;
+	double cents = 0.0;
+	long long* row = NULL;
+	size_t k = 0;
+	int n = 0;
+
+	(void)worker;
+	for (k = begin; k < end; k++)
+	{
+		//the rate amortCalculate() makes of an APR on the eighth grid
+		monthlyRate = ((double)k / EIGHTHS_PER_POINT) / MONTHPERCENT;
+		row = sheet->payments + k * SHEET_MONTHS;
+		growth = ONE;
+		for (n = 1; n <= SHEET_MONTHS; n++)
+		{
+			growth *= ONE + monthlyRate;
+			cents = growth * principal * monthlyRate / (growth - ONE) *
+				HUNDRED;
+			if (k == ZERO || cents - floor(cents) <= cents * GUARD ||
+				ceil(cents) - cents <= cents * GUARD)
+			{
+				row[n - ONE] = toCents(getPaymentAmount(n, principal,
+					monthlyRate));
+			}
+			else
+			{
+				row[n - ONE] = (long long)ceil(cents);
+			}
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		buildRateSheet()
+//  Title:			Build rate sheet
+//	Description:	This function will work out the payment for every APR
+//					eighth from 0 to maxEighths and every term, the APR
+//					rows spread over threadCount threads (0 for every
+//					processor)
+//	Input:			None
+//	Output:			None
+//	Calls:			parallelFor()
+//					buildSheetRows()
+//	Parameters:		sheet			(RateSheet*)
+//					principalCents	(long long)
+//					maxEighths		(int)
+//					threadCount		(int)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when memory runs out
+//	History Log:	10/17/2026 written for the rate sheet
+//----------------------------------------------------------------------------
+int buildRateSheet(RateSheet* sheet, long long principalCents,
+	int maxEighths, int threadCount)
+{
+	sheet->principalCents = principalCents;
+	sheet->aprRows = maxEighths + ONE;
+	sheet->payments = malloc((size_t)sheet->aprRows * SHEET_MONTHS *
+		sizeof(long long));
+	if (sheet->payments == NULL)
+	{
+		sheet->aprRows = 0;
+		return EXIT_FAILURE;
+	}
+	if (parallelFor(sheet->aprRows, SHEET_GRAIN, threadCount,
+		buildSheetRows, sheet) != EXIT_SUCCESS)
+	{
+		buildSheetRows(sheet, 0, sheet->aprRows, 0);
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		freeRateSheet()
+//  Title:			Free rate sheet
+//	Description:	This function will release the payments of a sheet
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		sheet	(RateSheet*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the rate sheet
+//----------------------------------------------------------------------------
+void freeRateSheet(RateSheet* sheet)
+{
+	free(sheet->payments);
+	sheet->payments = NULL;
+	sheet->aprRows = 0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getSheetPayment()
+//  Title:			Get sheet payment
+//	Description:	This function will look up one payment of a sheet
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		sheet		(const RateSheet*)
+//					aprEighths	(int)
+//					months		(int)
+//  Returns:		the payment in cents, or -1 outside the sheet
+//	History Log:	10/17/2026 written for the rate sheet
+//----------------------------------------------------------------------------
+long long getSheetPayment(const RateSheet* sheet, int aprEighths,
+	int months)
+{
+	if (aprEighths < ZERO || aprEighths >= sheet->aprRows ||
+		months <= ZERO || months > SHEET_MONTHS)
+	{
+		return -1;
+	}
+	return sheet->payments[(size_t)aprEighths * SHEET_MONTHS + months - ONE];
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeRateSheet()
+//  Title:			Write rate sheet
+//	Description:	This function will write a sheet as CSV, one line per
+//					APR with a column per term under a line naming the
+//					terms, or as a RateSheetHeader and the payments
+//	Input:			None
+//	Output:			the rate sheet
+//	Calls:			None
+//	Parameters:		file	(FILE*)
+//					sheet	(const RateSheet*)
+//					format	(int) SHEET_TEXT or SHEET_BINARY
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when a write fails
+//	History Log:	10/17/2026 written for the rate sheet
+//----------------------------------------------------------------------------
+int writeRateSheet(FILE* file, const RateSheet* sheet, int format)
+{
+	RateSheetHeader header;
+	const long long* row = NULL;
+	size_t cells = (size_t)sheet->aprRows * SHEET_MONTHS;
+	int k = 0;
+	int n = 0;
+
+	if (format == SHEET_BINARY)
+	{
+		memset(&header, ZERO, sizeof(header));
+		memcpy(header.magic, SHEET_MAGIC, sizeof(header.magic));
+		header.version = SHEET_VERSION;
+		header.principalCents = sheet->principalCents;
+		header.aprRows = sheet->aprRows;
+		header.months = SHEET_MONTHS;
+		if (fwrite(&header, sizeof(header), ONE, file) != ONE ||
+			fwrite(sheet->payments, sizeof(long long), cells, file) != cells)
+		{
+			return EXIT_FAILURE;
+		}
+		return EXIT_SUCCESS;
+	}
+	fprintf(file, "# monthly payment on $%lld.%02lld\nAPR",
+		sheet->principalCents / HUNDRED, sheet->principalCents % HUNDRED);
+	for (n = 1; n <= SHEET_MONTHS; n++)
+	{
+		fprintf(file, ",%d", n);
+	}
+	fprintf(file, "\n");
+	for (k = 0; k < sheet->aprRows; k++)
+	{
+		row = sheet->payments + (size_t)k * SHEET_MONTHS;
+		fprintf(file, "%.3lf", (double)k / EIGHTHS_PER_POINT);
+		for (n = 0; n < SHEET_MONTHS; n++)
+		{
+			fprintf(file, ",%lld.%02lld", row[n] / HUNDRED, row[n] % HUNDRED);
+		}
+		fprintf(file, "\n");
+	}
+	return ferror(file) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runRateSheet()
+//  Title:			Run rate sheet
+//	Description:	This function will build the rate sheet of a principal
+//					for every APR eighth up to maxApr and write it to a
+//					file
+//	Input:			None
+//	Output:			the rate sheet file, errors to stderr
+//	Calls:			roundToOneEighth()
+//					toCents()
+//					buildRateSheet()
+//					writeRateSheet()
+//					freeRateSheet()
+//	Parameters:		outName		(const char*)
+//					principal	(double)
+//					maxApr		(double)
+//					format		(int) SHEET_TEXT or SHEET_BINARY
+//					threadCount	(int)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when the file cannot be
+//					written or the principal or APR is out of range
+//	History Log:	10/17/2026 written for the rate sheet
+//----------------------------------------------------------------------------
+int runRateSheet(const char* outName, double principal, double maxApr,
+	int format, int threadCount)
+{
+	RateSheet sheet;
+	FILE * outFileHandle = NULL;
+	long long principalCents = toCents(principal);
+	int returnValue = EXIT_SUCCESS;
+
+	if (principalCents <= ZERO || !(maxApr >= ZERO) ||
+		maxApr > SHEET_APR_LIMIT)
+	{
+		fprintf(stderr, "The principal must be above 0 and the APR from 0 "
+			"to %d\n", SHEET_APR_LIMIT);
+		return EXIT_FAILURE;
+	}
+	if (buildRateSheet(&sheet, principalCents,
+		(int)(roundToOneEighth(maxApr) * EIGHTHS_PER_POINT), threadCount) !=
+		EXIT_SUCCESS)
+	{
+		fprintf(stderr, "Not enough memory for the rate sheet\n");
+		return EXIT_FAILURE;
+	}
+	outFileHandle = fopen(outName, format == SHEET_BINARY ? "wb" : "w");
+	if (outFileHandle == NULL)
+	{
+		fprintf(stderr, "Could not open %s\n", outName);
+		returnValue = EXIT_FAILURE;
+	}
+	else
+	{
+		if (writeRateSheet(outFileHandle, &sheet, format) != EXIT_SUCCESS)
+		{
+			returnValue = EXIT_FAILURE;
+		}
+		if (fclose(outFileHandle) != ZERO)
+		{
+			returnValue = EXIT_FAILURE;
+		}
+	}
+	freeRateSheet(&sheet);
+	return returnValue;
+}
@@ -0,0 +1,45 @@
+#ifndef AMORTSHEET_H
+#define AMORTSHEET_H
+#include <stdio.h>
+#include "AmortApi.h"
+#define SHEET_MAGIC "AMRS"
+#define SHEET_VERSION 1
+#define SHEET_MONTHS AMORT_MAX_MONTHS
+#define SHEET_PRINCIPAL 1000
+#define SHEET_MAX_APR 30
+#define SHEET_APR_LIMIT 100
+#define SHEET_TEXT 0
+#define SHEET_BINARY 1
+#define SHEET_GRAIN 4
+//----------------------------------------------------------------------------
+// RateSheetHeader: starts a binary rate sheet. It is followed by aprRows
+//		rows of months payments, all as long long cents in the byte order
+//		of the machine that wrote the file; row k is the APR k / 8
+//----------------------------------------------------------------------------
+typedef struct RateSheetHeader {
+	char magic[4];
+	int version;
+	long long principalCents;
+	int aprRows;
+	int months;
+} RateSheetHeader;
+//----------------------------------------------------------------------------
+// RateSheet: the monthly payment on principalCents for every APR eighth
+//		from 0 to aprRows - 1 and every term from 1 to SHEET_MONTHS, in
+//		cents at payments[aprEighths * SHEET_MONTHS + months - 1]; each
+//		one is what getPaymentAmount() gives
+//----------------------------------------------------------------------------
+typedef struct RateSheet {
+	long long principalCents;
+	int aprRows;
+	long long* payments;
+} RateSheet;
+int buildRateSheet(RateSheet* sheet, long long principalCents,
+	int maxEighths, int threadCount);
+void freeRateSheet(RateSheet* sheet);
+long long getSheetPayment(const RateSheet* sheet, int aprEighths,
+	int months);
+int writeRateSheet(FILE* file, const RateSheet* sheet, int format);
+int runRateSheet(const char* outName, double principal, double maxApr,
+	int format, int threadCount);
+#endif
@@ -0,0 +1,812 @@
+#include "AmortSimd.h"
+#include <float.h>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+	defined(_M_IX86)
+#define HAVE_AVX2 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define AVX2_TARGET
+#else
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+#endif
+#else
+#define HAVE_AVX2 0
+#endif
+#define ONE 1
+#define ZERO 0
+#define HUNDRED 100
+#define HALF 0.5
+#define LANES 4
+#define UNKNOWN -1
+#define SAFETY 16
+#define EXP_LIMIT 700.0
+#define EIGHT 8
+#define YEARLY_INTEREST_RATE 1200
+#define APR_TOLERANCE 1e-12
+#define APR_ITERATIONS 100
+#define APR_GUARD 1e-9
+
+static int simdLevel = UNKNOWN;
+
+//----------------------------------------------------------------------------
+//	Function:		detectSimdLevel()
+//  Title:			Detect SIMD level
+//	Description:	This function will ask the processor whether it can run
+//					the AVX2/FMA kernels
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		SIMD_AVX2 or SIMD_NONE
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+static int detectSimdLevel(void)
+{
+#if HAVE_AVX2
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 1);
+	//fma, osxsave and avx, then ymm state enabled by the OS
+	if ((info[2] & 0x18001000) != 0x18001000 ||
+		(_xgetbv(0) & 6) != 6)
+	{
+		return SIMD_NONE;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & 0x20) ? SIMD_AVX2 : SIMD_NONE;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ?
+		SIMD_AVX2 : SIMD_NONE;
+#endif
+#else
+	return SIMD_NONE;
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getSimdLevel()
+//  Title:			Get SIMD level
+//	Description:	This function will tell which kernels the array
+//					functions use, detecting the processor the first time
+//	Input:			None
+//	Output:			None
+//	Calls:			detectSimdLevel()
+//	Parameters:		None
+//  Returns:		SIMD_AVX2 or SIMD_NONE
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+int getSimdLevel(void)
+{
+	if (simdLevel == UNKNOWN)
+	{
+		simdLevel = detectSimdLevel();
+	}
+	return simdLevel;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		setSimdLevel()
+//  Title:			Set SIMD level
+//	Description:	This function will force the array functions onto the
+//					scalar path (SIMD_NONE) or back onto the best kernels
+//					the processor supports, for comparing the two
+//	Input:			None
+//	Output:			None
+//	Calls:			detectSimdLevel()
+//	Parameters:		level	(int)
+//  Returns:		the level now in use
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+int setSimdLevel(int level)
+{
+	int supported = detectSimdLevel();
+	simdLevel = level < supported ? level : supported;
+	return simdLevel;
+}
+
+#if HAVE_AVX2
+//----------------------------------------------------------------------------
+//	Function:		vectorExp()
+//  Title:			Vector exp
+//	Description:	This function will compute e^x in four lanes: x is split
+//					into k ln2 + f with |f| <= ln2 / 2, e^f comes from its
+//					Taylor series to the 13th power (error below 1e-17) and
+//					2^k is built directly in the exponent bits. Lanes must
+//					stay within +-EXP_LIMIT
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		x	(__m256d)
+//  Returns:		e^x in each lane
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+static AVX2_TARGET __m256d vectorExp(__m256d x)
+{
+	static const double coefficients[] = {
+		1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0,
+		1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0, 1.0 / 5040.0,
+		1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 0.5, 1.0, 1.0 };
+	__m256d k = _mm256_round_pd(
+		_mm256_mul_pd(x, _mm256_set1_pd(1.4426950408889634)),
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	__m256d f = _mm256_fnmadd_pd(k, _mm256_set1_pd(6.93147180369123816490e-01),
+		x);
+	__m256d sum = _mm256_set1_pd(coefficients[0]);
+	__m256i power;
+	int i = 0;
+
+	f = _mm256_fnmadd_pd(k, _mm256_set1_pd(1.90821492927058770002e-10), f);
+	for (i = 1; i < (int)(sizeof(coefficients) / sizeof(double)); i++)
+	{
+		sum = _mm256_fmadd_pd(sum, f, _mm256_set1_pd(coefficients[i]));
+	}
+	power = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k));
+	power = _mm256_slli_epi64(_mm256_add_epi64(power,
+		_mm256_set1_epi64x(1023)), 52);
+	return _mm256_mul_pd(sum, _mm256_castsi256_pd(power));
+}
+
+//----------------------------------------------------------------------------
+//	Function:		vectorLog()
+//  Title:			Vector log
+//	Description:	This function will compute ln(x) in four lanes for
+//					positive normal x: x = 2^e m with m in [sqrt(2)/2,
+//					sqrt(2)), ln(m) = 2 atanh(s) with s = (m - 1) / (m + 1)
+//					summed to s^23 (error below 1e-17) and e ln2 added in
+//					two parts
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		x	(__m256d)
+//  Returns:		ln(x) in each lane
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+static AVX2_TARGET __m256d vectorLog(__m256d x)
+{
+	static const double coefficients[] = {
+		1.0 / 23.0, 1.0 / 21.0, 1.0 / 19.0, 1.0 / 17.0, 1.0 / 15.0,
+		1.0 / 13.0, 1.0 / 11.0, 1.0 / 9.0, 1.0 / 7.0, 1.0 / 5.0, 1.0 / 3.0 };
+	const __m256d magic = _mm256_castsi256_pd(
+		_mm256_set1_epi64x(0x4330000000000000LL));
+	__m256i bits = _mm256_castpd_si256(x);
+	__m256d exponent = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+		_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(magic))), magic);
+	__m256d mantissa = _mm256_castsi256_pd(_mm256_or_si256(
+		_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+		_mm256_set1_epi64x(0x3FF0000000000000LL)));
+	__m256d large = _mm256_cmp_pd(mantissa,
+		_mm256_set1_pd(1.41421356237309504880), _CMP_GT_OQ);
+	__m256d s;
+	__m256d z;
+	__m256d sum = _mm256_set1_pd(coefficients[0]);
+	__m256d result;
+	int i = 0;
+
+	mantissa = _mm256_blendv_pd(mantissa,
+		_mm256_mul_pd(mantissa, _mm256_set1_pd(HALF)), large);
+	exponent = _mm256_add_pd(_mm256_sub_pd(exponent, _mm256_set1_pd(1023.0)),
+		_mm256_and_pd(large, _mm256_set1_pd(1.0)));
+	s = _mm256_div_pd(_mm256_sub_pd(mantissa, _mm256_set1_pd(1.0)),
+		_mm256_add_pd(mantissa, _mm256_set1_pd(1.0)));
+	z = _mm256_mul_pd(s, s);
+	for (i = 1; i < (int)(sizeof(coefficients) / sizeof(double)); i++)
+	{
+		sum = _mm256_fmadd_pd(sum, z, _mm256_set1_pd(coefficients[i]));
+	}
+	//2s + 2s z sum + e ln2, small parts first
+	s = _mm256_add_pd(s, s);
+	result = _mm256_fmadd_pd(exponent,
+		_mm256_set1_pd(1.90821492927058770002e-10),
+		_mm256_mul_pd(_mm256_mul_pd(s, z), sum));
+	result = _mm256_add_pd(s, result);
+	return _mm256_fmadd_pd(exponent,
+		_mm256_set1_pd(6.93147180369123816490e-01), result);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		nearWhole()
+//  Title:			Near whole
+//	Description:	This function will flag the lanes where x is within
+//					tolerance of a whole number, where ceil() or floor()
+//					could go the other way than in the scalar function
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		x			(__m256d)
+//					tolerance	(__m256d)
+//  Returns:		lane mask
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+static AVX2_TARGET __m256d nearWhole(__m256d x, __m256d tolerance)
+{
+	__m256d distance = _mm256_sub_pd(x, _mm256_round_pd(x,
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+	distance = _mm256_andnot_pd(_mm256_set1_pd(-0.0), distance);
+	//also catches NaN lanes
+	return _mm256_cmp_pd(distance, tolerance, _CMP_NGT_UQ);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		growthError()
+//  Title:			Growth error
+//	Description:	This function will bound the relative error of a
+//					growth factor g = e^t built by vectorExp(vectorLog()),
+//					times g / (g - 1) which the payment and loan formulas
+//					multiply it by
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		exponent	(__m256d) t
+//					growth		(__m256d) g
+//  Returns:		relative error bound in each lane
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+static AVX2_TARGET __m256d growthError(__m256d exponent, __m256d growth)
+{
+	__m256d error = _mm256_mul_pd(_mm256_set1_pd(SAFETY * DBL_EPSILON),
+		_mm256_add_pd(_mm256_set1_pd(SAFETY), _mm256_andnot_pd(
+		_mm256_set1_pd(-0.0), exponent)));
+	return _mm256_div_pd(_mm256_mul_pd(error, growth),
+		_mm256_sub_pd(growth, _mm256_set1_pd(1.0)));
+}
+
+//----------------------------------------------------------------------------
+//	Function:		paymentKernel()
+//  Title:			Payment kernel
+//	Description:	This function will run getPaymentAmount() four loans
+//					at a time and return how many loans it finished. Lanes
+//					whose cents sit too close to a whole cent, or whose
+//					growth factor is out of range, are redone by the scalar
+//					function so every payment matches it exactly
+//	Input:			None
+//	Output:			None
+//	Calls:			vectorLog()
+//					vectorExp()
+//					growthError()
+//					nearWhole()
+//					getPaymentAmount()
+//	Parameters:		months		(const int*)
+//					principal	(const double*)
+//					monthlyRate	(const double*)
+//					payment		(double*)
+//					count		(size_t)
+//  Returns:		number of loans done, a multiple of LANES
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+static AVX2_TARGET size_t paymentKernel(const int* months,
+	const double* principal, const double* monthlyRate, double* payment,
+	size_t count)
+{
+	const __m256d one = _mm256_set1_pd(1.0);
+	const __m256d hundred = _mm256_set1_pd(HUNDRED);
+	const __m256d zero = _mm256_setzero_pd();
+	size_t i = 0;
+	int lane = 0;
+	int redo = 0;
+
+	for (i = 0; i + LANES <= count; i += LANES)
+	{
+		__m256d n = _mm256_cvtepi32_pd(
+			_mm_loadu_si128((const __m128i*)(months + i)));
+		__m256d loan = _mm256_loadu_pd(principal + i);
+		__m256d rate = _mm256_loadu_pd(monthlyRate + i);
+		__m256d exponent = _mm256_mul_pd(n,
+			vectorLog(_mm256_add_pd(one, rate)));
+		__m256d growth = vectorExp(exponent);
+		__m256d cents = _mm256_mul_pd(_mm256_div_pd(
+			_mm256_mul_pd(_mm256_mul_pd(growth, loan), rate),
+			_mm256_sub_pd(growth, one)), hundred);
+		__m256d flat = _mm256_mul_pd(_mm256_div_pd(loan, n), hundred);
+		__m256d isFlat = _mm256_cmp_pd(rate, zero, _CMP_EQ_OQ);
+		__m256d tolerance = _mm256_mul_pd(cents,
+			growthError(exponent, growth));
+		__m256d bad = _mm256_andnot_pd(isFlat, _mm256_or_pd(
+			nearWhole(cents, tolerance), _mm256_cmp_pd(
+			_mm256_andnot_pd(_mm256_set1_pd(-0.0), exponent),
+			_mm256_set1_pd(EXP_LIMIT), _CMP_NLT_UQ)));
+
+		cents = _mm256_blendv_pd(cents, flat, isFlat);
+		_mm256_storeu_pd(payment + i, _mm256_div_pd(_mm256_round_pd(cents,
+			_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC), hundred));
+		redo = _mm256_movemask_pd(bad);
+		for (lane = 0; redo != 0; lane++, redo >>= 1)
+		{
+			if (redo & ONE)
+			{
+				payment[i + lane] = getPaymentAmount(months[i + lane],
+					principal[i + lane], monthlyRate[i + lane]);
+			}
+		}
+	}
+	return i;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		loanKernel()
+//  Title:			Loan kernel
+//	Description:	This function will run getLoanAmount() four loans at a
+//					time the same way paymentKernel() does for payments,
+//					checking against the half cent roundToNearestCent()
+//					rounds at
+//	Input:			None
+//	Output:			None
+//	Calls:			vectorLog()
+//					vectorExp()
+//					growthError()
+//					nearWhole()
+//					getLoanAmount()
+//	Parameters:		months			(const int*)
+//					totalPayment	(const double*)
+//					monthlyRate		(const double*)
+//					principal		(double*)
+//					count			(size_t)
+//  Returns:		number of loans done, a multiple of LANES
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+static AVX2_TARGET size_t loanKernel(const int* months,
+	const double* totalPayment, const double* monthlyRate, double* principal,
+	size_t count)
+{
+	const __m256d one = _mm256_set1_pd(1.0);
+	const __m256d hundred = _mm256_set1_pd(HUNDRED);
+	const __m256d half = _mm256_set1_pd(HALF);
+	const __m256d zero = _mm256_setzero_pd();
+	size_t i = 0;
+	int lane = 0;
+	int redo = 0;
+
+	for (i = 0; i + LANES <= count; i += LANES)
+	{
+		__m256d n = _mm256_cvtepi32_pd(
+			_mm_loadu_si128((const __m128i*)(months + i)));
+		__m256d pay = _mm256_loadu_pd(totalPayment + i);
+		__m256d rate = _mm256_loadu_pd(monthlyRate + i);
+		__m256d exponent = _mm256_mul_pd(n,
+			vectorLog(_mm256_add_pd(one, rate)));
+		__m256d growth = vectorExp(exponent);
+		__m256d cents = _mm256_add_pd(_mm256_mul_pd(_mm256_div_pd(
+			_mm256_mul_pd(_mm256_sub_pd(growth, one), pay),
+			_mm256_mul_pd(growth, rate)), hundred), half);
+		__m256d flat = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(pay, n),
+			hundred), half);
+		__m256d isFlat = _mm256_cmp_pd(rate, zero, _CMP_EQ_OQ);
+		__m256d tolerance = _mm256_mul_pd(cents,
+			growthError(exponent, growth));
+		__m256d bad = _mm256_or_pd(_mm256_andnot_pd(isFlat, _mm256_or_pd(
+			nearWhole(cents, tolerance), _mm256_cmp_pd(
+			_mm256_andnot_pd(_mm256_set1_pd(-0.0), exponent),
+			_mm256_set1_pd(EXP_LIMIT), _CMP_NLT_UQ))),
+			_mm256_and_pd(isFlat, nearWhole(flat, _mm256_mul_pd(flat,
+			_mm256_set1_pd(SAFETY * DBL_EPSILON)))));
+
+		cents = _mm256_blendv_pd(cents, flat, isFlat);
+		_mm256_storeu_pd(principal + i, _mm256_div_pd(_mm256_round_pd(cents,
+			_MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC), hundred));
+		redo = _mm256_movemask_pd(bad);
+		for (lane = 0; redo != 0; lane++, redo >>= 1)
+		{
+			if (redo & ONE)
+			{
+				principal[i + lane] = getLoanAmount(months[i + lane],
+					totalPayment[i + lane], monthlyRate[i + lane]);
+			}
+		}
+	}
+	return i;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		monthsKernel()
+//  Title:			Months kernel
+//	Description:	This function will run getNumberOfMonths() four loans
+//					at a time. Lanes whose month count is too close to a
+//					whole number for ceil(), or whose payment does not
+//					cover the interest, are redone by the scalar function
+//	Input:			None
+//	Output:			None
+//	Calls:			vectorLog()
+//					nearWhole()
+//					getNumberOfMonths()
+//	Parameters:		principal		(const double*)
+//					totalPayment	(const double*)
+//					monthlyRate		(const double*)
+//					months			(int*)
+//					count			(size_t)
+//  Returns:		number of loans done, a multiple of LANES
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+static AVX2_TARGET size_t monthsKernel(const double* principal,
+	const double* totalPayment, const double* monthlyRate, int* months,
+	size_t count)
+{
+	const __m256d one = _mm256_set1_pd(1.0);
+	const __m256d zero = _mm256_setzero_pd();
+	const __m256d sign = _mm256_set1_pd(-0.0);
+	size_t i = 0;
+	int lane = 0;
+	int redo = 0;
+
+	for (i = 0; i + LANES <= count; i += LANES)
+	{
+		__m256d loan = _mm256_loadu_pd(principal + i);
+		__m256d pay = _mm256_loadu_pd(totalPayment + i);
+		__m256d rate = _mm256_loadu_pd(monthlyRate + i);
+		__m256d left = _mm256_sub_pd(pay, _mm256_mul_pd(loan, rate));
+		__m256d logPay = vectorLog(pay);
+		__m256d logLeft = vectorLog(left);
+		__m256d bottom = vectorLog(_mm256_add_pd(one, rate));
+		__m256d periods = _mm256_div_pd(_mm256_sub_pd(logPay, logLeft),
+			bottom);
+		__m256d flat = _mm256_div_pd(loan, pay);
+		__m256d isFlat = _mm256_cmp_pd(rate, zero, _CMP_EQ_OQ);
+		//log errors, plus the cancellation in pay - loan * rate
+		__m256d spread = _mm256_add_pd(_mm256_add_pd(
+			_mm256_andnot_pd(sign, logPay), _mm256_andnot_pd(sign, logLeft)),
+			_mm256_div_pd(pay, left));
+		__m256d tolerance = _mm256_mul_pd(_mm256_set1_pd(SAFETY * DBL_EPSILON),
+			_mm256_add_pd(_mm256_add_pd(_mm256_div_pd(spread, bottom),
+			periods), _mm256_set1_pd(SAFETY)));
+		__m256d bad = _mm256_andnot_pd(isFlat, _mm256_or_pd(
+			nearWhole(periods, tolerance),
+			_mm256_cmp_pd(left, zero, _CMP_NGT_UQ)));
+
+		periods = _mm256_round_pd(_mm256_blendv_pd(periods, flat, isFlat),
+			_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+		_mm_storeu_si128((__m128i*)(months + i),
+			_mm256_cvttpd_epi32(periods));
+		redo = _mm256_movemask_pd(bad);
+		for (lane = 0; redo != 0; lane++, redo >>= 1)
+		{
+			if (redo & ONE)
+			{
+				months[i + lane] = getNumberOfMonths(principal[i + lane],
+					totalPayment[i + lane], monthlyRate[i + lane]);
+			}
+		}
+	}
+	return i;
+}
+
+//----------------------------------------------------------------------------
+// RateLanes: four APR solves in flight, one per lane
+//		low, high	bracket around each root
+//		rate		current guess
+//		active		all ones in lanes still iterating
+//----------------------------------------------------------------------------
+typedef struct RateLanes {
+	__m256d target;
+	__m256d months;
+	__m256d low;
+	__m256d high;
+	__m256d rate;
+	__m256d active;
+} RateLanes;
+
+//----------------------------------------------------------------------------
+//	Function:		startRateLanes()
+//  Title:			Start rate lanes
+//	Description:	This function will set up four solves the way
+//					solveMonthlyRate() starts one. Lanes whose payments do
+//					not cover the loan get rate 0 and start inactive
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		lanes			(RateLanes*)
+//					sizeOfLoan		(const double*)
+//					monthlyPayment	(const double*)
+//					months			(const int*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for lockstep APR solving
+//----------------------------------------------------------------------------
+static AVX2_TARGET void startRateLanes(RateLanes* lanes,
+	const double* sizeOfLoan, const double* monthlyPayment, const int* months)
+{
+	const __m256d one = _mm256_set1_pd(1.0);
+	__m256d loan = _mm256_loadu_pd(sizeOfLoan);
+	__m256d pay = _mm256_loadu_pd(monthlyPayment);
+	__m256d guess;
+
+	lanes->months = _mm256_cvtepi32_pd(
+		_mm_loadu_si128((const __m128i*)months));
+	lanes->active = _mm256_cmp_pd(_mm256_mul_pd(pay, lanes->months), loan,
+		_CMP_GT_OQ);
+	lanes->target = _mm256_div_pd(pay, loan);
+	lanes->low = _mm256_setzero_pd();
+	lanes->high = lanes->target;
+	guess = _mm256_div_pd(_mm256_mul_pd(_mm256_sub_pd(lanes->target,
+		_mm256_div_pd(one, lanes->months)), _mm256_add_pd(lanes->months,
+		lanes->months)), _mm256_add_pd(lanes->months, one));
+	lanes->rate = _mm256_and_pd(lanes->active,
+		_mm256_min_pd(guess, lanes->high));
+}
+
+//----------------------------------------------------------------------------
+//	Function:		stepRateLanes()
+//  Title:			Step rate lanes
+//	Description:	This function will take one safeguarded Newton step in
+//					every active lane, the same step solveMonthlyRate()
+//					takes, and switch off the lanes that have converged
+//	Input:			None
+//	Output:			None
+//	Calls:			vectorLog()
+//					vectorExp()
+//	Parameters:		lanes	(RateLanes*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for lockstep APR solving
+//----------------------------------------------------------------------------
+static AVX2_TARGET void stepRateLanes(RateLanes* lanes)
+{
+	const __m256d one = _mm256_set1_pd(1.0);
+	__m256d base = _mm256_add_pd(one, lanes->rate);
+	__m256d remaining = vectorExp(_mm256_mul_pd(lanes->months,
+		_mm256_sub_pd(_mm256_setzero_pd(), vectorLog(base))));
+	__m256d paidOff = _mm256_sub_pd(one, remaining);
+	__m256d value = _mm256_sub_pd(_mm256_div_pd(lanes->rate, paidOff),
+		lanes->target);
+	__m256d above = _mm256_cmp_pd(value, _mm256_setzero_pd(), _CMP_GT_OQ);
+	__m256d slope = _mm256_div_pd(_mm256_sub_pd(paidOff, _mm256_div_pd(
+		_mm256_mul_pd(_mm256_mul_pd(lanes->months, lanes->rate), remaining),
+		base)), _mm256_mul_pd(paidOff, paidOff));
+	__m256d next = _mm256_sub_pd(lanes->rate, _mm256_div_pd(value, slope));
+	__m256d done = _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0),
+		_mm256_sub_pd(next, lanes->rate)), _mm256_mul_pd(lanes->rate,
+		_mm256_set1_pd(APR_TOLERANCE)), _CMP_LE_OQ);
+	__m256d inside;
+
+	lanes->high = _mm256_blendv_pd(lanes->high, lanes->rate,
+		_mm256_and_pd(lanes->active, above));
+	lanes->low = _mm256_blendv_pd(lanes->low, lanes->rate,
+		_mm256_andnot_pd(above, lanes->active));
+	inside = _mm256_and_pd(_mm256_cmp_pd(next, lanes->low, _CMP_GT_OQ),
+		_mm256_cmp_pd(next, lanes->high, _CMP_LT_OQ));
+	next = _mm256_blendv_pd(_mm256_mul_pd(_mm256_add_pd(lanes->low,
+		lanes->high), _mm256_set1_pd(HALF)), next, _mm256_or_pd(inside, done));
+	lanes->rate = _mm256_blendv_pd(lanes->rate, next, lanes->active);
+	lanes->active = _mm256_andnot_pd(done, lanes->active);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		finishRateLanes()
+//  Title:			Finish rate lanes
+//	Description:	This function will turn four solved monthly rates into
+//					APRs rounded like getInterestRate() does. A lane that
+//					did not converge, or whose APR lies so close to the
+//					middle between two eighths that the vector error could
+//					pick the other one, is solved again by getInterestRate()
+//	Input:			None
+//	Output:			None
+//	Calls:			roundToOneEighth()
+//					getInterestRate()
+//	Parameters:		lanes			(RateLanes*)
+//					sizeOfLoan		(const double*)
+//					monthlyPayment	(const double*)
+//					months			(const int*)
+//					apr				(double*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for lockstep APR solving
+//----------------------------------------------------------------------------
+static AVX2_TARGET void finishRateLanes(RateLanes* lanes,
+	const double* sizeOfLoan, const double* monthlyPayment, const int* months,
+	double* apr)
+{
+	double rates[LANES];
+	int redo = _mm256_movemask_pd(lanes->active);
+	int lane = 0;
+	double eighths = 0.0;
+
+	_mm256_storeu_pd(rates, lanes->rate);
+	for (lane = 0; lane < LANES; lane++)
+	{
+		eighths = rates[lane] * YEARLY_INTEREST_RATE * EIGHT;
+		if ((redo >> lane) & ONE ||
+			fabs(eighths - floor(eighths) - HALF) <= APR_GUARD * eighths)
+		{
+			apr[lane] = getInterestRate(sizeOfLoan[lane], monthlyPayment[lane],
+				months[lane]);
+		}
+		else
+		{
+			apr[lane] = roundToOneEighth(rates[lane] * YEARLY_INTEREST_RATE);
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		rateKernel()
+//  Title:			Rate kernel
+//	Description:	This function will solve APRs eight loans at a time as
+//					two vectors of four lanes stepped in lockstep; a block
+//					keeps stepping until its slowest lane converges, the
+//					finished lanes are masked off meanwhile
+//	Input:			None
+//	Output:			None
+//	Calls:			startRateLanes()
+//					stepRateLanes()
+//					finishRateLanes()
+//	Parameters:		sizeOfLoan		(const double*)
+//					monthlyPayment	(const double*)
+//					months			(const int*)
+//					apr				(double*)
+//					count			(size_t)
+//  Returns:		number of loans done, a multiple of 2 * LANES
+//	History Log:	10/17/2026 written for lockstep APR solving
+//----------------------------------------------------------------------------
+static AVX2_TARGET size_t rateKernel(const double* sizeOfLoan,
+	const double* monthlyPayment, const int* months, double* apr,
+	size_t count)
+{
+	RateLanes first;
+	RateLanes second;
+	size_t i = 0;
+	int step = 0;
+
+	for (i = 0; i + 2 * LANES <= count; i += 2 * LANES)
+	{
+		startRateLanes(&first, sizeOfLoan + i, monthlyPayment + i, months + i);
+		startRateLanes(&second, sizeOfLoan + i + LANES,
+			monthlyPayment + i + LANES, months + i + LANES);
+		for (step = 0; step < APR_ITERATIONS && (_mm256_movemask_pd(
+			_mm256_or_pd(first.active, second.active)) != 0); step++)
+		{
+			stepRateLanes(&first);
+			stepRateLanes(&second);
+		}
+		finishRateLanes(&first, sizeOfLoan + i, monthlyPayment + i,
+			months + i, apr + i);
+		finishRateLanes(&second, sizeOfLoan + i + LANES,
+			monthlyPayment + i + LANES, months + i + LANES, apr + i + LANES);
+	}
+	return i;
+}
+#endif
+
+//----------------------------------------------------------------------------
+//	Function:		getPaymentAmountArray()
+//  Title:			Get payment amount for an array
+//	Description:	This function will set payment[i] to
+//					getPaymentAmount(months[i], principal[i],
+//					monthlyRate[i]) for every loan, using the AVX2 kernel
+//					when the processor has it
+//	Input:			None
+//	Output:			None
+//	Calls:			getSimdLevel()
+//					paymentKernel()
+//					getPaymentAmount()
+//	Parameters:		months		(const int*)
+//					principal	(const double*)
+//					monthlyRate	(const double*)
+//					payment		(double*)
+//					count		(size_t)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+void getPaymentAmountArray(const int* months, const double* principal,
+	const double* monthlyRate, double* payment, size_t count)
+{
+	size_t i = 0;
+#if HAVE_AVX2
+	if (getSimdLevel() == SIMD_AVX2)
+	{
+		i = paymentKernel(months, principal, monthlyRate, payment, count);
+	}
+#endif
+	for (; i < count; i++)
+	{
+		payment[i] = getPaymentAmount(months[i], principal[i],
+			monthlyRate[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getLoanAmountArray()
+//  Title:			Get loan amount for an array
+//	Description:	This function will set principal[i] to
+//					getLoanAmount(months[i], totalPayment[i],
+//					monthlyRate[i]) for every loan, using the AVX2 kernel
+//					when the processor has it
+//	Input:			None
+//	Output:			None
+//	Calls:			getSimdLevel()
+//					loanKernel()
+//					getLoanAmount()
+//	Parameters:		months			(const int*)
+//					totalPayment	(const double*)
+//					monthlyRate		(const double*)
+//					principal		(double*)
+//					count			(size_t)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+void getLoanAmountArray(const int* months, const double* totalPayment,
+	const double* monthlyRate, double* principal, size_t count)
+{
+	size_t i = 0;
+#if HAVE_AVX2
+	if (getSimdLevel() == SIMD_AVX2)
+	{
+		i = loanKernel(months, totalPayment, monthlyRate, principal, count);
+	}
+#endif
+	for (; i < count; i++)
+	{
+		principal[i] = getLoanAmount(months[i], totalPayment[i],
+			monthlyRate[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getNumberOfMonthsArray()
+//  Title:			Get number of months for an array
+//	Description:	This function will set months[i] to
+//					getNumberOfMonths(principal[i], totalPayment[i],
+//					monthlyRate[i]) for every loan, using the AVX2 kernel
+//					when the processor has it
+//	Input:			None
+//	Output:			None
+//	Calls:			getSimdLevel()
+//					monthsKernel()
+//					getNumberOfMonths()
+//	Parameters:		principal		(const double*)
+//					totalPayment	(const double*)
+//					monthlyRate		(const double*)
+//					months			(int*)
+//					count			(size_t)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the SIMD array kernels
+//----------------------------------------------------------------------------
+void getNumberOfMonthsArray(const double* principal,
+	const double* totalPayment, const double* monthlyRate, int* months,
+	size_t count)
+{
+	size_t i = 0;
+#if HAVE_AVX2
+	if (getSimdLevel() == SIMD_AVX2)
+	{
+		i = monthsKernel(principal, totalPayment, monthlyRate, months, count);
+	}
+#endif
+	for (; i < count; i++)
+	{
+		months[i] = getNumberOfMonths(principal[i], totalPayment[i],
+			monthlyRate[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getInterestRateArray()
+//  Title:			Get interest rate for an array
+//	Description:	This function will set apr[i] to
+//					getInterestRate(sizeOfLoan[i], monthlyPayment[i],
+//					months[i]) for every loan, solving eight loans at once
+//					when the processor has AVX2
+//	Input:			None
+//	Output:			None
+//	Calls:			getSimdLevel()
+//					rateKernel()
+//					getInterestRate()
+//	Parameters:		sizeOfLoan		(const double*)
+//					monthlyPayment	(const double*)
+//					months			(const int*)
+//					apr				(double*)
+//					count			(size_t)
+//  Returns:		void
+//	History Log:	10/17/2026 written for lockstep APR solving
+//----------------------------------------------------------------------------
+void getInterestRateArray(const double* sizeOfLoan,
+	const double* monthlyPayment, const int* months, double* apr,
+	size_t count)
+{
+	size_t i = 0;
+#if HAVE_AVX2
+	if (getSimdLevel() == SIMD_AVX2)
+	{
+		i = rateKernel(sizeOfLoan, monthlyPayment, months, apr, count);
+	}
+#endif
+	for (; i < count; i++)
+	{
+		apr[i] = getInterestRate(sizeOfLoan[i], monthlyPayment[i], months[i]);
+	}
+}
@@ -0,0 +1,19 @@
+#ifndef AMORTSIMD_H
+#define AMORTSIMD_H
+#include <stddef.h>
+#include "Amort.h"
+#define SIMD_NONE 0
+#define SIMD_AVX2 1
+int getSimdLevel(void);
+int setSimdLevel(int level);
+void getPaymentAmountArray(const int* months, const double* principal,
+	const double* monthlyRate, double* payment, size_t count);
+void getLoanAmountArray(const int* months, const double* totalPayment,
+	const double* monthlyRate, double* principal, size_t count);
+void getNumberOfMonthsArray(const double* principal,
+	const double* totalPayment, const double* monthlyRate, int* months,
+	size_t count);
+void getInterestRateArray(const double* sizeOfLoan,
+	const double* monthlyPayment, const int* months, double* apr,
+	size_t count);
+#endif
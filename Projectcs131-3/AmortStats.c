@@ -0,0 +1,626 @@
+#include "AmortStats.h"
+#include "AmortThread.h"
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <time.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+#define ONE 1
+#define ZERO 0
+#define TRUE 1
+#define FALSE 0
+#define NANOSECONDS 1000000000LL
+#define PERCENTILES 5
+
+//----------------------------------------------------------------------------
+// StatsBlock: the statistics one thread records without locking. Only
+//		its owner writes a block, but readStats() reads it while the owner
+//		may still be running, so every value is loaded and stored whole
+//		with readStatsValue() and writeStatsValue(). Blocks are never
+//		freed: a thread that ends hands its block to the next thread that
+//		starts, so the counts keep adding up
+//----------------------------------------------------------------------------
+typedef struct StatsBlock {
+	OpStats ops[STATS_OPS];
+	long long counters[STATS_COUNTERS];
+	int inUse;
+	struct StatsBlock* next;
+} StatsBlock;
+
+static const char* opNames[STATS_OPS] = {
+	"getPaymentAmount", "getLoanAmount", "getNumberOfMonths",
+	"getInterestRate", "tableWrite" };
+static const char* counterNames[STATS_COUNTERS] = {
+	"newtonSteps", "newtonFailures", "tableRows", "tableBytes" };
+static const double percentiles[PERCENTILES] = {
+	0.5, 0.9, 0.99, 0.999, 1.0 };
+static const char* percentileNames[PERCENTILES] = {
+	"p50", "p90", "p99", "p999", "p100" };
+
+static AmortMutex statsLock;
+static StatsBlock* blocks = NULL;
+static int statsReady = FALSE;
+static THREAD_LOCAL StatsBlock* threadBlock = NULL;
+#ifdef _WIN32
+static DWORD blockKey = FLS_OUT_OF_INDEXES;
+static double clockScale = 0.0;
+#else
+static pthread_key_t blockKey;
+#endif
+
+//----------------------------------------------------------------------------
+//	Function:		readStatsValue()
+//  Title:			Read stats value
+//	Description:	This function will load one count of a block as a
+//					relaxed atomic, so a count its owner is storing is
+//					read whole, either before or after the store
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		value	(const long long*)
+//  Returns:		the count
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+static long long readStatsValue(const long long* value)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+	return *(const volatile long long*)value;
+#elif defined(_MSC_VER)
+	return _InterlockedCompareExchange64((volatile long long*)value, ZERO,
+		ZERO);
+#else
+	return __atomic_load_n(value, __ATOMIC_RELAXED);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeStatsValue()
+//  Title:			Write stats value
+//	Description:	This function will store one count of the calling
+//					thread's block as a relaxed atomic. Only the owner
+//					stores to a block, so adding to a count needs no
+//					locked instruction, just a whole store
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		value	(long long*)
+//					amount	(long long)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+static void writeStatsValue(long long* value, long long amount)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+	*(volatile long long*)value = amount;
+#elif defined(_MSC_VER)
+	long long seen = *value;
+	long long before = 0;
+	while ((before = _InterlockedCompareExchange64((volatile long long*)value,
+		amount, seen)) != seen)
+	{
+		seen = before;
+	}
+#else
+	__atomic_store_n(value, amount, __ATOMIC_RELAXED);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		releaseStatsBlock()
+//  Title:			Release stats block
+//	Description:	This function will run when a thread that recorded
+//					statistics ends and hand its block back for reuse
+//	Input:			None
+//	Output:			None
+//	Calls:			lockMutex()
+//					unlockMutex()
+//	Parameters:		block	(void*) the thread's StatsBlock
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+#ifdef _WIN32
+static VOID WINAPI releaseStatsBlock(PVOID block)
+#else
+static void releaseStatsBlock(void* block)
+#endif
+{
+	if (block != NULL)
+	{
+		lockMutex(&statsLock);
+		((StatsBlock*)block)->inUse = FALSE;
+		unlockMutex(&statsLock);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		initStats()
+//  Title:			Initialize stats
+//	Description:	This function will get the statistics ready. It has to
+//					run before the first thread that records starts; until
+//					it does nothing is recorded
+//	Input:			None
+//	Output:			None
+//	Calls:			initMutex()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+void initStats(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER frequency;
+#endif
+	if (statsReady)
+	{
+		return;
+	}
+	initMutex(&statsLock);
+#ifdef _WIN32
+	QueryPerformanceFrequency(&frequency);
+	clockScale = (double)NANOSECONDS / frequency.QuadPart;
+	blockKey = FlsAlloc(releaseStatsBlock);
+	statsReady = blockKey != FLS_OUT_OF_INDEXES;
+#else
+	statsReady = pthread_key_create(&blockKey, releaseStatsBlock) == ZERO;
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		isStatsEnabled()
+//  Title:			Is stats enabled
+//	Description:	This function will tell whether the library was built
+//					with AMORT_STATS
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		TRUE or FALSE
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+int isStatsEnabled(void)
+{
+#ifdef AMORT_STATS
+	return TRUE;
+#else
+	return FALSE;
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readStatsClock()
+//  Title:			Read stats clock
+//	Description:	This function will read the monotonic clock
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		nanoseconds from an arbitrary start
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+long long readStatsClock(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER count;
+	QueryPerformanceCounter(&count);
+	return (long long)(count.QuadPart * clockScale);
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long)now.tv_sec * NANOSECONDS + now.tv_nsec;
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getStatsBlock()
+//  Title:			Get stats block
+//	Description:	This function will find the calling thread's block,
+//					taking a free one or adding a new one the first time
+//					the thread records anything
+//	Input:			None
+//	Output:			None
+//	Calls:			lockMutex()
+//					unlockMutex()
+//	Parameters:		None
+//  Returns:		the block, or NULL before initStats() or without memory
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+static StatsBlock* getStatsBlock(void)
+{
+	StatsBlock* block = threadBlock;
+	if (block != NULL || !statsReady)
+	{
+		return block;
+	}
+	lockMutex(&statsLock);
+	for (block = blocks; block != NULL && block->inUse; block = block->next)
+	{
+	}
+	if (block == NULL)
+	{
+		block = calloc(ONE, sizeof(StatsBlock));
+		if (block != NULL)
+		{
+			block->next = blocks;
+			blocks = block;
+		}
+	}
+	if (block != NULL)
+	{
+		block->inUse = TRUE;
+	}
+	unlockMutex(&statsLock);
+	if (block != NULL)
+	{
+#ifdef _WIN32
+		FlsSetValue(blockKey, block);
+#else
+		pthread_setspecific(blockKey, block);
+#endif
+		threadBlock = block;
+	}
+	return block;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getStatsBucket()
+//  Title:			Get stats bucket
+//	Description:	This function will find the histogram bucket of a
+//					latency: the top STATS_SUB_BITS + 1 bits of it, so
+//					every bucket is within 1 / STATS_SUB_COUNT of its
+//					values
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		nanos	(long long) not negative
+//  Returns:		the bucket, the last one for STATS_MAX_BITS bits or more
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+static int getStatsBucket(long long nanos)
+{
+	int top = 0;
+#ifdef _MSC_VER
+	unsigned long index = 0;
+#endif
+	if (nanos < STATS_SUB_COUNT)
+	{
+		return (int)nanos;
+	}
+	if (nanos >> STATS_MAX_BITS != ZERO)
+	{
+		return STATS_BUCKETS - ONE;
+	}
+#ifdef _MSC_VER
+	_BitScanReverse64(&index, (unsigned long long)nanos);
+	top = (int)index;
+#else
+	top = 63 - __builtin_clzll((unsigned long long)nanos);
+#endif
+	return (top - STATS_SUB_BITS) * STATS_SUB_COUNT +
+		(int)(nanos >> (top - STATS_SUB_BITS));
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getStatsBucketLow()
+//  Title:			Get stats bucket low
+//	Description:	This function will give the smallest latency that
+//					falls in a bucket
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		bucket	(int)
+//  Returns:		nanoseconds
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+long long getStatsBucketLow(int bucket)
+{
+	int shift = bucket / STATS_SUB_COUNT - ONE;
+	if (shift <= ZERO)
+	{
+		return bucket;
+	}
+	return (long long)(bucket % STATS_SUB_COUNT + STATS_SUB_COUNT) << shift;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		recordStatsLatency()
+//  Title:			Record stats latency
+//	Description:	This function will count one call of an operation in
+//					the calling thread's block
+//	Input:			None
+//	Output:			None
+//	Calls:			getStatsBlock()
+//					getStatsBucket()
+//					writeStatsValue()
+//	Parameters:		op		(int) STATS_PAYMENT ... STATS_TABLE_WRITE
+//					nanos	(long long)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//					10/17/2026 store the counts whole for readStats()
+//----------------------------------------------------------------------------
+void recordStatsLatency(int op, long long nanos)
+{
+	StatsBlock* block = getStatsBlock();
+	OpStats* stats = NULL;
+	long long* bucket = NULL;
+	if (block == NULL)
+	{
+		return;
+	}
+	if (nanos < ZERO)
+	{
+		nanos = 0;
+	}
+	stats = &block->ops[op];
+	bucket = &stats->histogram[getStatsBucket(nanos)];
+	writeStatsValue(&stats->calls, stats->calls + ONE);
+	writeStatsValue(&stats->totalNanos, stats->totalNanos + nanos);
+	if (nanos > stats->maxNanos)
+	{
+		writeStatsValue(&stats->maxNanos, nanos);
+	}
+	writeStatsValue(bucket, *bucket + ONE);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		addStatsCount()
+//  Title:			Add stats count
+//	Description:	This function will add to one of the plain counters
+//	Input:			None
+//	Output:			None
+//	Calls:			getStatsBlock()
+//					writeStatsValue()
+//	Parameters:		counter	(int) STATS_NEWTON_STEPS ... STATS_TABLE_BYTES
+//					amount	(long long)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//					10/17/2026 store the counter whole for readStats()
+//----------------------------------------------------------------------------
+void addStatsCount(int counter, long long amount)
+{
+	StatsBlock* block = getStatsBlock();
+	if (block != NULL)
+	{
+		writeStatsValue(&block->counters[counter],
+			block->counters[counter] + amount);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readStats()
+//  Title:			Read stats
+//	Description:	This function will add up the blocks of every thread.
+//					Threads still running are not stopped: every count is
+//					loaded whole, but their part may be a few calls behind
+//					and one call may show in some counts and not yet in
+//					others
+//	Input:			None
+//	Output:			None
+//	Calls:			lockMutex()
+//					readStatsValue()
+//					unlockMutex()
+//	Parameters:		snapshot	(StatsSnapshot*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//					10/17/2026 load the counts whole while their threads run
+//----------------------------------------------------------------------------
+void readStats(StatsSnapshot* snapshot)
+{
+	StatsBlock* block = NULL;
+	OpStats* total = NULL;
+	const OpStats* part = NULL;
+	long long longest = 0;
+	int op = 0;
+	int i = 0;
+	memset(snapshot, ZERO, sizeof(StatsSnapshot));
+	if (!statsReady)
+	{
+		return;
+	}
+	lockMutex(&statsLock);
+	for (block = blocks; block != NULL; block = block->next)
+	{
+		for (op = 0; op < STATS_OPS; op++)
+		{
+			total = &snapshot->ops[op];
+			part = &block->ops[op];
+			total->calls += readStatsValue(&part->calls);
+			total->totalNanos += readStatsValue(&part->totalNanos);
+			longest = readStatsValue(&part->maxNanos);
+			if (longest > total->maxNanos)
+			{
+				total->maxNanos = longest;
+			}
+			for (i = 0; i < STATS_BUCKETS; i++)
+			{
+				total->histogram[i] += readStatsValue(&part->histogram[i]);
+			}
+		}
+		for (i = 0; i < STATS_COUNTERS; i++)
+		{
+			snapshot->counters[i] += readStatsValue(&block->counters[i]);
+		}
+	}
+	unlockMutex(&statsLock);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getStatsPercentile()
+//  Title:			Get stats percentile
+//	Description:	This function will find the latency that fraction of
+//					the calls stayed within, to the bucket
+//	Input:			None
+//	Output:			None
+//	Calls:			getStatsBucketLow()
+//	Parameters:		op			(const OpStats*)
+//					fraction	(double) 0.99 for the 99th percentile
+//  Returns:		the top of the bucket holding that call, at most the
+//					largest latency seen; 0 without calls
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+long long getStatsPercentile(const OpStats* op, double fraction)
+{
+	long long rank = (long long)(fraction * op->calls + 0.5);
+	long long seen = 0;
+	long long top = 0;
+	int i = 0;
+	if (op->calls == ZERO)
+	{
+		return 0;
+	}
+	if (rank < ONE)
+	{
+		rank = 1;
+	}
+	for (i = 0; i < STATS_BUCKETS; i++)
+	{
+		seen += op->histogram[i];
+		if (seen >= rank)
+		{
+			break;
+		}
+	}
+	top = i + ONE < STATS_BUCKETS ? getStatsBucketLow(i + ONE) - ONE :
+		op->maxNanos;
+	return top < op->maxNanos ? top : op->maxNanos;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeStatsText()
+//  Title:			Write stats text
+//	Description:	This function will write a snapshot as a table, one
+//					operation per line, leaving out operations never called
+//	Input:			None
+//	Output:			the table
+//	Calls:			getStatsPercentile()
+//	Parameters:		file		(FILE*)
+//					snapshot	(const StatsSnapshot*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+static void writeStatsText(FILE* file, const StatsSnapshot* snapshot)
+{
+	const OpStats* op = NULL;
+	int i = 0;
+	int j = 0;
+	fprintf(file, "%-18s %12s %10s", "operation", "calls", "mean ns");
+	for (j = 0; j < PERCENTILES; j++)
+	{
+		fprintf(file, " %10s", percentileNames[j]);
+	}
+	fprintf(file, "\n");
+	for (i = 0; i < STATS_OPS; i++)
+	{
+		op = &snapshot->ops[i];
+		if (op->calls == ZERO)
+		{
+			continue;
+		}
+		fprintf(file, "%-18s %12lld %10.1f", opNames[i], op->calls,
+			(double)op->totalNanos / op->calls);
+		for (j = 0; j < PERCENTILES; j++)
+		{
+			fprintf(file, " %10lld", getStatsPercentile(op, percentiles[j]));
+		}
+		fprintf(file, "\n");
+	}
+	for (i = 0; i < STATS_COUNTERS; i++)
+	{
+		fprintf(file, "%-18s %12lld\n", counterNames[i],
+			snapshot->counters[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeStatsJson()
+//  Title:			Write stats JSON
+//	Description:	This function will write a snapshot as one JSON object
+//					with the summary of every operation and the buckets
+//					that are not empty as [lowest ns, calls] pairs
+//	Input:			None
+//	Output:			the JSON object
+//	Calls:			getStatsPercentile()
+//					getStatsBucketLow()
+//	Parameters:		file		(FILE*)
+//					snapshot	(const StatsSnapshot*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+static void writeStatsJson(FILE* file, const StatsSnapshot* snapshot)
+{
+	const OpStats* op = NULL;
+	const char* separator = "";
+	int i = 0;
+	int j = 0;
+	fprintf(file, "{\"operations\":{");
+	for (i = 0; i < STATS_OPS; i++)
+	{
+		op = &snapshot->ops[i];
+		fprintf(file, "%s\"%s\":{\"calls\":%lld,\"totalNs\":%lld",
+			i > ZERO ? "," : "", opNames[i], op->calls, op->totalNanos);
+		for (j = 0; j < PERCENTILES; j++)
+		{
+			fprintf(file, ",\"%sNs\":%lld", percentileNames[j],
+				getStatsPercentile(op, percentiles[j]));
+		}
+		fprintf(file, ",\"histogram\":[");
+		separator = "";
+		for (j = 0; j < STATS_BUCKETS; j++)
+		{
+			if (op->histogram[j] != ZERO)
+			{
+				fprintf(file, "%s[%lld,%lld]", separator,
+					getStatsBucketLow(j), op->histogram[j]);
+				separator = ",";
+			}
+		}
+		fprintf(file, "]}");
+	}
+	fprintf(file, "},\"counters\":{");
+	for (i = 0; i < STATS_COUNTERS; i++)
+	{
+		fprintf(file, "%s\"%s\":%lld", i > ZERO ? "," : "", counterNames[i],
+			snapshot->counters[i]);
+	}
+	fprintf(file, "}}\n");
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeStats()
+//  Title:			Write stats
+//	Description:	This function will take a snapshot of the statistics
+//					and write it as text or JSON
+//	Input:			None
+//	Output:			the statistics
+//	Calls:			readStats()
+//					writeStatsText()
+//					writeStatsJson()
+//	Parameters:		file	(FILE*)
+//					format	(int) STATS_TEXT or STATS_JSON
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when memory runs out
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+int writeStats(FILE* file, int format)
+{
+	StatsSnapshot* snapshot = malloc(sizeof(StatsSnapshot));
+	if (snapshot == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+	readStats(snapshot);
+	if (format == STATS_JSON)
+	{
+		writeStatsJson(file, snapshot);
+	}
+	else
+	{
+		writeStatsText(file, snapshot);
+	}
+	free(snapshot);
+	return EXIT_SUCCESS;
+}
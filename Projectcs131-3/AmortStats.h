@@ -0,0 +1,65 @@
+#ifndef AMORTSTATS_H
+#define AMORTSTATS_H
+#include <stdio.h>
+#define STATS_SUB_BITS 4
+#define STATS_SUB_COUNT (1 << STATS_SUB_BITS)
+#define STATS_MAX_BITS 40
+#define STATS_BUCKETS ((STATS_MAX_BITS - STATS_SUB_BITS + 1) * STATS_SUB_COUNT)
+#define STATS_TEXT 0
+#define STATS_JSON 1
+//the timed operations
+#define STATS_PAYMENT 0
+#define STATS_LOAN 1
+#define STATS_MONTHS 2
+#define STATS_RATE 3
+#define STATS_TABLE_WRITE 4
+#define STATS_OPS 5
+//the plain counters
+#define STATS_NEWTON_STEPS 0
+#define STATS_NEWTON_FAILURES 1
+#define STATS_TABLE_ROWS 2
+#define STATS_TABLE_BYTES 3
+#define STATS_COUNTERS 4
+//----------------------------------------------------------------------------
+// The hot paths record through these macros, which are empty unless the
+// library is built with AMORT_STATS (cmake -DAMORT_STATS=ON), so a normal
+// build pays nothing for them
+//----------------------------------------------------------------------------
+#ifdef AMORT_STATS
+#define STATS_START(start) (start) = readStatsClock()
+#define STATS_STOP(op, start) \
+	recordStatsLatency(op, readStatsClock() - (start))
+#define STATS_COUNT(counter, amount) addStatsCount(counter, amount)
+#else
+#define STATS_START(start) ((void)(start))
+#define STATS_STOP(op, start) ((void)(start))
+#define STATS_COUNT(counter, amount) ((void)0)
+#endif
+//----------------------------------------------------------------------------
+// OpStats: calls and latency of one operation. histogram[i] counts the
+//		calls whose nanoseconds fall in bucket i: exact below
+//		STATS_SUB_COUNT, then STATS_SUB_COUNT buckets per power of 2
+//----------------------------------------------------------------------------
+typedef struct OpStats {
+	long long calls;
+	long long totalNanos;
+	long long maxNanos;
+	long long histogram[STATS_BUCKETS];
+} OpStats;
+//----------------------------------------------------------------------------
+// StatsSnapshot: every thread's statistics added together
+//----------------------------------------------------------------------------
+typedef struct StatsSnapshot {
+	OpStats ops[STATS_OPS];
+	long long counters[STATS_COUNTERS];
+} StatsSnapshot;
+void initStats(void);
+int isStatsEnabled(void);
+long long readStatsClock(void);
+void recordStatsLatency(int op, long long nanos);
+void addStatsCount(int counter, long long amount);
+void readStats(StatsSnapshot* snapshot);
+long long getStatsBucketLow(int bucket);
+long long getStatsPercentile(const OpStats* op, double fraction);
+int writeStats(FILE* file, int format);
+#endif
@@ -0,0 +1,259 @@
+#include "AmortThread.h"
+#include <stdlib.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#define ONE 1
+
+//----------------------------------------------------------------------------
+// ThreadStart: what a new thread has to call, handed to threadEntry()
+//----------------------------------------------------------------------------
+typedef struct ThreadStart {
+	AmortThreadFunction function;
+	void* argument;
+} ThreadStart;
+
+//----------------------------------------------------------------------------
+//	Function:		threadEntry()
+//  Title:			Thread entry
+//	Description:	This function will run the function given to
+//					createThread() with the signature each platform expects
+//	Input:			None
+//	Output:			None
+//	Calls:			the thread function
+//	Parameters:		start	(void*)
+//  Returns:		0
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+#ifdef _WIN32
+static DWORD WINAPI threadEntry(LPVOID start)
+#else
+static void* threadEntry(void* start)
+#endif
+{
+	ThreadStart begin = *(ThreadStart*)start;
+	free(start);
+	begin.function(begin.argument);
+	return 0;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		createThread()
+//  Title:			Create thread
+//	Description:	This function will start a thread running
+//					function(argument)
+//	Input:			None
+//	Output:			None
+//	Calls:			threadEntry()
+//	Parameters:		thread	(AmortThread*)
+//					function	(AmortThreadFunction)
+//					argument	(void*)
+//  Returns:		EXIT_SUCCESS or EXIT_FAILURE
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+int createThread(AmortThread* thread, AmortThreadFunction function,
+	void* argument)
+{
+	ThreadStart* start = malloc(sizeof(ThreadStart));
+	if (start == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+	start->function = function;
+	start->argument = argument;
+#ifdef _WIN32
+	*thread = CreateThread(NULL, 0, threadEntry, start, 0, NULL);
+	if (*thread == NULL)
+#else
+	if (pthread_create(thread, NULL, threadEntry, start) != 0)
+#endif
+	{
+		free(start);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		joinThread()
+//  Title:			Join thread
+//	Description:	This function will wait for a thread to finish
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		thread	(AmortThread)
+//  Returns:		void
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+void joinThread(AmortThread thread)
+{
+#ifdef _WIN32
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+#else
+	pthread_join(thread, NULL);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		initMutex(), lockMutex(), unlockMutex(), destroyMutex()
+//  Title:			Mutex
+//	Description:	These functions will wrap the platform mutex
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		mutex	(AmortMutex*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+void initMutex(AmortMutex* mutex)
+{
+#ifdef _WIN32
+	InitializeCriticalSection(mutex);
+#else
+	pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+void lockMutex(AmortMutex* mutex)
+{
+#ifdef _WIN32
+	EnterCriticalSection(mutex);
+#else
+	pthread_mutex_lock(mutex);
+#endif
+}
+
+void unlockMutex(AmortMutex* mutex)
+{
+#ifdef _WIN32
+	LeaveCriticalSection(mutex);
+#else
+	pthread_mutex_unlock(mutex);
+#endif
+}
+
+void destroyMutex(AmortMutex* mutex)
+{
+#ifdef _WIN32
+	DeleteCriticalSection(mutex);
+#else
+	pthread_mutex_destroy(mutex);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		initCondition(), waitCondition(), wakeCondition()
+//  Title:			Condition
+//	Description:	These functions will wrap the platform condition
+//					variable. waitCondition() is called with the mutex held
+//					and holds it again when it returns, maybe without a
+//					wake, so callers wait in a loop on their own test.
+//					wakeCondition() wakes every waiting thread
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		condition	(AmortCondition*)
+//					mutex		(AmortMutex*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the parked workers of
+//					parallelFor()
+//----------------------------------------------------------------------------
+void initCondition(AmortCondition* condition)
+{
+#ifdef _WIN32
+	InitializeConditionVariable(condition);
+#else
+	pthread_cond_init(condition, NULL);
+#endif
+}
+
+void waitCondition(AmortCondition* condition, AmortMutex* mutex)
+{
+#ifdef _WIN32
+	SleepConditionVariableCS(condition, mutex, INFINITE);
+#else
+	pthread_cond_wait(condition, mutex);
+#endif
+}
+
+void wakeCondition(AmortCondition* condition)
+{
+#ifdef _WIN32
+	WakeAllConditionVariable(condition);
+#else
+	pthread_cond_broadcast(condition);
+#endif
+}
+
+#ifdef _WIN32
+//----------------------------------------------------------------------------
+//	Function:		onceEntry()
+//  Title:			Once entry
+//	Description:	This function will call the function given to runOnce()
+//					with the signature InitOnceExecuteOnce() expects
+//	Input:			None
+//	Output:			None
+//	Calls:			the once function
+//	Parameters:		once		(PINIT_ONCE)
+//					function	(PVOID)
+//					context		(PVOID*)
+//  Returns:		TRUE
+//	History Log:	10/17/2026 written for runOnce()
+//----------------------------------------------------------------------------
+static BOOL CALLBACK onceEntry(PINIT_ONCE once, PVOID function,
+	PVOID* context)
+{
+	(void)once;
+	(void)context;
+	((AmortOnceFunction)function)();
+	return TRUE;
+}
+#endif
+
+//----------------------------------------------------------------------------
+//	Function:		runOnce()
+//  Title:			Run once
+//	Description:	This function will call function the first time it is
+//					reached for once, however many threads reach it; the
+//					others wait until that call has returned
+//	Input:			None
+//	Output:			None
+//	Calls:			onceEntry()
+//	Parameters:		once		(AmortOnce*) set to AMORT_ONCE_INIT
+//					function	(AmortOnceFunction)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the parallelFor() worker pool
+//----------------------------------------------------------------------------
+void runOnce(AmortOnce* once, AmortOnceFunction function)
+{
+#ifdef _WIN32
+	InitOnceExecuteOnce(once, onceEntry, (PVOID)function, NULL);
+#else
+	pthread_once(once, function);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//	Function:		getCpuCount()
+//  Title:			Get CPU count
+//	Description:	This function will find how many processors are online
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		None
+//  Returns:		the number of processors, at least 1
+//	History Log:	10/17/2026 written for multi-threaded pricing
+//----------------------------------------------------------------------------
+int getCpuCount(void)
+{
+	long count = 0;
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	count = (long)info.dwNumberOfProcessors;
+#else
+	count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	return count < ONE ? ONE : (int)count;
+}
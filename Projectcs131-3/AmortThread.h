@@ -0,0 +1,32 @@
+#ifndef AMORTTHREAD_H
+#define AMORTTHREAD_H
+#ifdef _WIN32
+#include <windows.h>
+typedef HANDLE AmortThread;
+typedef CRITICAL_SECTION AmortMutex;
+typedef CONDITION_VARIABLE AmortCondition;
+typedef INIT_ONCE AmortOnce;
+#define AMORT_ONCE_INIT INIT_ONCE_STATIC_INIT
+#else
+#include <pthread.h>
+typedef pthread_t AmortThread;
+typedef pthread_mutex_t AmortMutex;
+typedef pthread_cond_t AmortCondition;
+typedef pthread_once_t AmortOnce;
+#define AMORT_ONCE_INIT PTHREAD_ONCE_INIT
+#endif
+typedef void (*AmortThreadFunction)(void* argument);
+typedef void (*AmortOnceFunction)(void);
+int createThread(AmortThread* thread, AmortThreadFunction function,
+	void* argument);
+void joinThread(AmortThread thread);
+void initMutex(AmortMutex* mutex);
+void lockMutex(AmortMutex* mutex);
+void unlockMutex(AmortMutex* mutex);
+void destroyMutex(AmortMutex* mutex);
+void initCondition(AmortCondition* condition);
+void waitCondition(AmortCondition* condition, AmortMutex* mutex);
+void wakeCondition(AmortCondition* condition);
+void runOnce(AmortOnce* once, AmortOnceFunction function);
+int getCpuCount(void);
+#endif
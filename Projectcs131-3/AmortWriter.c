@@ -0,0 +1,416 @@
+#include "AmortWriter.h"
+#include "AmortStats.h"
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#define ONE 1
+#define ZERO 0
+#define TEN 10
+#define HUNDRED 100
+#define HALF 0.5
+#define SAFETY 4
+#define MONTH_WIDTH 5
+#define PAYMENT_WIDTH 8
+#define PAID_WIDTH 13
+#define BALANCE_WIDTH 12
+#define DIGITS_MAX 24
+#define FAST_LIMIT 1e15
+
+//----------------------------------------------------------------------------
+//	Function:		putText()
+//  Title:			Put text
+//	Description:	This function will copy text into the writer's buffer
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		out		(char*)
+//					text	(const char*)
+//					length	(size_t)
+//  Returns:		the position after the text
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+static char* putText(char* out, const char* text, size_t length)
+{
+	memcpy(out, text, length);
+	return out + length;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		putMonth()
+//  Title:			Put month
+//	Description:	This function will write a month number left justified
+//					in MONTH_WIDTH columns, as "%-5d" does
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		out		(char*)
+//					month	(int)
+//  Returns:		the position after the field
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+static char* putMonth(char* out, int month)
+{
+	char digits[DIGITS_MAX];
+	int count = 0;
+	int i = 0;
+	if (month < ZERO)
+	{
+		return out + sprintf(out, "%-5d", month);
+	}
+	do
+	{
+		digits[count++] = (char)('0' + month % TEN);
+		month /= TEN;
+	} while (month > ZERO);
+	for (i = count - ONE; i >= 0; i--)
+	{
+		*out++ = digits[i];
+	}
+	for (; count < MONTH_WIDTH; count++)
+	{
+		*out++ = ' ';
+	}
+	return out;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		putCents()
+//  Title:			Put cents
+//	Description:	This function will write a whole number of cents right
+//					justified in width columns as dollars with two decimals
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		out		(char*)
+//					cents	(long long)
+//					width	(int)
+//  Returns:		the position after the field
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//----------------------------------------------------------------------------
+static char* putCents(char* out, long long cents, int width)
+{
+	char digits[DIGITS_MAX];
+	unsigned long long left = cents < ZERO ? ZERO - (unsigned long long)cents :
+		(unsigned long long)cents;
+	int count = 0;
+	digits[count++] = (char)('0' + left % TEN);
+	left /= TEN;
+	digits[count++] = (char)('0' + left % TEN);
+	left /= TEN;
+	digits[count++] = '.';
+	do
+	{
+		digits[count++] = (char)('0' + left % TEN);
+		left /= TEN;
+	} while (left > ZERO);
+	if (cents < ZERO)
+	{
+		digits[count++] = '-';
+	}
+	for (; width > count; width--)
+	{
+		*out++ = ' ';
+	}
+	while (count > ZERO)
+	{
+		*out++ = digits[--count];
+	}
+	return out;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		putMoney()
+//  Title:			Put money
+//	Description:	This function will write an amount right justified in
+//					width columns with two decimals, as "%*.2lf" does, by
+//					turning it into whole cents and printing the integer.
+//					Amounts printf() might round differently (negative, huge,
+//					or within rounding error of half a cent) go through
+//					sprintf() so the text is always the same as before
+//	Input:			None
+//	Output:			None
+//	Calls:			putCents()
+//	Parameters:		out		(char*)
+//					amount	(double)
+//					width	(int)
+//  Returns:		the position after the field
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+static char* putMoney(char* out, double amount, int width)
+{
+	double scaled = amount * HUNDRED;
+	double lower = floor(scaled);
+	long long cents = 0;
+
+	if (signbit(amount) || !(amount < FAST_LIMIT) ||
+		fabs(scaled - lower - HALF) <= scaled * SAFETY * DBL_EPSILON)
+	{
+		return out + sprintf(out, "%*.2lf", width, amount);
+	}
+	cents = (long long)lower + (scaled - lower > HALF ? ONE : ZERO);
+	return putCents(out, cents, width);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		formatMoney()
+//  Title:			Format money
+//	Description:	This function will write an amount with two decimals and
+//					no padding, the same text "%.2lf" gives, for callers that
+//					build their own lines
+//	Input:			None
+//	Output:			None
+//	Calls:			putMoney()
+//	Parameters:		out		(char*) room for WRITER_MONEY_MAX characters
+//					amount	(double)
+//  Returns:		the position after the amount
+//	History Log:	10/17/2026 written for the pricing server
+//----------------------------------------------------------------------------
+char* formatMoney(char* out, double amount)
+{
+	return putMoney(out, amount, ZERO);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		openTableWriter()
+//  Title:			Open table writer
+//	Description:	This function will set up a writer on an open file
+//	Input:			None
+//	Output:			None
+//	Calls:			None
+//	Parameters:		writer	(TableWriter*)
+//					file	(FILE*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when memory runs out
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+int openTableWriter(TableWriter* writer, FILE* file)
+{
+	writer->file = file;
+	writer->used = 0;
+	writer->capacity = WRITER_BUFFER_SIZE;
+	writer->buffer = malloc(writer->capacity);
+	writer->status = writer->buffer == NULL ? EXIT_FAILURE : EXIT_SUCCESS;
+	return writer->status;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeRoom()
+//  Title:			Make room
+//	Description:	This function will flush the buffer when one more line
+//					might not fit
+//	Input:			None
+//	Output:			None
+//	Calls:			flushTableWriter()
+//	Parameters:		writer	(TableWriter*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+static void makeRoom(TableWriter* writer)
+{
+	if (writer->capacity - writer->used < WRITER_LINE_MAX)
+	{
+		flushTableWriter(writer);
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeTableHeader()
+//  Title:			Write table header
+//	Description:	This function will write the title and column names
+//					printTable() puts above the rows
+//	Input:			None
+//	Output:			None
+//	Calls:			flushTableWriter()
+//	Parameters:		writer		(TableWriter*)
+//					principal	(double)
+//					monthlyRate	(double)
+//					months		(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+void writeTableHeader(TableWriter* writer, double principal,
+	double monthlyRate, int months)
+{
+	if (flushTableWriter(writer) == EXIT_SUCCESS &&
+		fprintf(writer->file, "Amortization Table for $%.2lf Loan "
+		"at %.3lf%% interest for %d months\n\n%s %22s %15s %15s\n",
+		principal, monthlyRate * 1200, months, "Payments",
+		"Principal Paid", "Interest Paid", "Loan Balance") < 0)
+	{
+		writer->status = EXIT_FAILURE;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeTableRow()
+//  Title:			Write table row
+//	Description:	This function will write one row in the layout
+//					"%-5d ( %8.2lf) $ %13.2lf $ %13.2lf $ %12.2lf \n"
+//	Input:			None
+//	Output:			None
+//	Calls:			makeRoom()
+//					putMonth()
+//					putMoney()
+//					putText()
+//	Parameters:		writer	(TableWriter*)
+//					row		(const ScheduleRow*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+void writeTableRow(TableWriter* writer, const ScheduleRow* row)
+{
+	char* out = NULL;
+	makeRoom(writer);
+	out = writer->buffer + writer->used;
+	out = putMonth(out, row->month);
+	out = putText(out, " ( ", 3);
+	out = putMoney(out, row->payment, PAYMENT_WIDTH);
+	out = putText(out, ") $ ", 4);
+	out = putMoney(out, row->principalPaid, PAID_WIDTH);
+	out = putText(out, " $ ", 3);
+	out = putMoney(out, row->interestPaid, PAID_WIDTH);
+	out = putText(out, " $ ", 3);
+	out = putMoney(out, row->balance, BALANCE_WIDTH);
+	out = putText(out, " \n", 2);
+	writer->used = out - writer->buffer;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeTableRows()
+//  Title:			Write table rows
+//	Description:	This function will write count rows
+//	Input:			None
+//	Output:			None
+//	Calls:			writeTableRow()
+//					addStatsCount() with AMORT_STATS
+//	Parameters:		writer	(TableWriter*)
+//					rows	(const ScheduleRow*)
+//					count	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for the buffered table writer
+//					10/17/2026 rows counted under AMORT_STATS
+//----------------------------------------------------------------------------
+void writeTableRows(TableWriter* writer, const ScheduleRow* rows, int count)
+{
+	int i = 0;
+	for (i = 0; i < count; i++)
+	{
+		writeTableRow(writer, &rows[i]);
+	}
+	STATS_COUNT(STATS_TABLE_ROWS, count);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeCentsRow()
+//  Title:			Write cents row
+//	Description:	This function will add one row of a cents schedule to
+//					the buffer in the same layout as writeTableRow()
+//	Input:			None
+//	Output:			None
+//	Calls:			makeRoom()
+//					putMonth()
+//					putCents()
+//					putText()
+//	Parameters:		writer	(TableWriter*)
+//					row		(const CentsRow*)
+//  Returns:		void
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//----------------------------------------------------------------------------
+void writeCentsRow(TableWriter* writer, const CentsRow* row)
+{
+	char* out = NULL;
+	makeRoom(writer);
+	out = writer->buffer + writer->used;
+	out = putMonth(out, row->month);
+	out = putText(out, " ( ", 3);
+	out = putCents(out, row->payment, PAYMENT_WIDTH);
+	out = putText(out, ") $ ", 4);
+	out = putCents(out, row->principalPaid, PAID_WIDTH);
+	out = putText(out, " $ ", 3);
+	out = putCents(out, row->interestPaid, PAID_WIDTH);
+	out = putText(out, " $ ", 3);
+	out = putCents(out, row->balance, BALANCE_WIDTH);
+	out = putText(out, " \n", 2);
+	writer->used = out - writer->buffer;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeCentsRows()
+//  Title:			Write cents rows
+//	Description:	This function will add count rows of a cents schedule
+//	Input:			None
+//	Output:			None
+//	Calls:			writeCentsRow()
+//					addStatsCount() with AMORT_STATS
+//	Parameters:		writer	(TableWriter*)
+//					rows	(const CentsRow*)
+//					count	(int)
+//  Returns:		void
+//	History Log:	10/17/2026 written for whole-cent arithmetic
+//					10/17/2026 rows counted under AMORT_STATS
+//----------------------------------------------------------------------------
+void writeCentsRows(TableWriter* writer, const CentsRow* rows, int count)
+{
+	int i = 0;
+	for (i = 0; i < count; i++)
+	{
+		writeCentsRow(writer, &rows[i]);
+	}
+	STATS_COUNT(STATS_TABLE_ROWS, count);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		flushTableWriter()
+//  Title:			Flush table writer
+//	Description:	This function will hand the buffered text to the file
+//	Input:			None
+//	Output:			the buffered text
+//	Calls:			readStatsClock(), recordStatsLatency() and
+//					addStatsCount() with AMORT_STATS
+//	Parameters:		writer	(TableWriter*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE once a write has failed
+//	History Log:	10/17/2026 written for the buffered table writer
+//					10/17/2026 writes timed and bytes counted under
+//					AMORT_STATS
+//----------------------------------------------------------------------------
+int flushTableWriter(TableWriter* writer)
+{
+	long long start = 0;
+	if (writer->used > ZERO)
+	{
+		STATS_START(start);
+		if (fwrite(writer->buffer, ONE, writer->used, writer->file) !=
+			writer->used)
+		{
+			writer->status = EXIT_FAILURE;
+		}
+		STATS_STOP(STATS_TABLE_WRITE, start);
+		STATS_COUNT(STATS_TABLE_BYTES, writer->used);
+	}
+	writer->used = 0;
+	return writer->status;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		closeTableWriter()
+//  Title:			Close table writer
+//	Description:	This function will flush and release the writer; the
+//					file stays open for the caller to close
+//	Input:			None
+//	Output:			the buffered text
+//	Calls:			flushTableWriter()
+//	Parameters:		writer	(TableWriter*)
+//  Returns:		EXIT_SUCCESS, or EXIT_FAILURE when a write failed
+//	History Log:	10/17/2026 written for the buffered table writer
+//----------------------------------------------------------------------------
+int closeTableWriter(TableWriter* writer)
+{
+	int status = EXIT_SUCCESS;
+	if (writer->buffer != NULL)
+	{
+		status = flushTableWriter(writer);
+	}
+	free(writer->buffer);
+	writer->buffer = NULL;
+	return status;
+}
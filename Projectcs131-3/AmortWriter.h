@@ -0,0 +1,31 @@
+#ifndef AMORTWRITER_H
+#define AMORTWRITER_H
+#include <stdio.h>
+#include "AmortSchedule.h"
+#include "AmortCents.h"
+#define WRITER_BUFFER_SIZE (1 << 20)
+#define WRITER_LINE_MAX 2048
+#define WRITER_MONEY_MAX 320
+//----------------------------------------------------------------------------
+// TableWriter: formats amortization tables into one large buffer that is
+//		handed to the file in big chunks
+//		status		EXIT_SUCCESS until a write fails
+//----------------------------------------------------------------------------
+typedef struct TableWriter {
+	FILE* file;
+	char* buffer;
+	size_t used;
+	size_t capacity;
+	int status;
+} TableWriter;
+char* formatMoney(char* out, double amount);
+int openTableWriter(TableWriter* writer, FILE* file);
+void writeTableHeader(TableWriter* writer, double principal,
+	double monthlyRate, int months);
+void writeTableRow(TableWriter* writer, const ScheduleRow* row);
+void writeTableRows(TableWriter* writer, const ScheduleRow* rows, int count);
+void writeCentsRow(TableWriter* writer, const CentsRow* row);
+void writeCentsRows(TableWriter* writer, const CentsRow* rows, int count);
+int flushTableWriter(TableWriter* writer);
+int closeTableWriter(TableWriter* writer);
+#endif
@@ -1,17 +1,57 @@
 //----------------------------------------------------------------------------
 // File: MainAmortization.c
 // Functions:
+//		static void dumpStats(void)
 //		int main(int argc, char *argv[])
 //----------------------------------------------------------------------------
 #include <stdio.h>
 #include <stdlib.h>
-#include <conio.h>
 #include "Amort.h"
+#include "AmortConsole.h"
+#include "AmortBatch.h"
+#include "AmortGrowth.h"
+#include "AmortCents.h"
+#include "AmortServer.h"
+#include "AmortPortfolio.h"
+#include "AmortStats.h"
+#include "AmortSheet.h"
+#include "AmortScan.h"
+#include "AmortBinary.h"
+#include <string.h>
 #define TRUE 1
 #define FALSE 0
 #define MONTHPERCENT 1200
+#define APR_BAND 1
+#define TERM_BAND 60
+
+//the format "--stats" asked for
+static int statsFormat = STATS_TEXT;
+
+//----------------------------------------------------------------------------
+//	Function:		dumpStats()
+//  Title:			Dump stats
+//	Description:	This function will write the statistics to stderr when
+//					the program ends
+//	Input:			None
+//	Output:			the statistics on stderr
+//	Calls:			isStatsEnabled()
+//					writeStats()
+//	Parameters:		None
+//  Returns:		void
+//	History Log:	10/17/2026 written for the latency statistics
+//----------------------------------------------------------------------------
+static void dumpStats(void)
+{
+	if (!isStatsEnabled())
+	{
+		fprintf(stderr, "Statistics need a build with AMORT_STATS\n");
+		return;
+	}
+	writeStats(stderr, statsFormat);
+}
+
 //----------------------------------------------------------------------------
-// Function:		main(void)		
+// Function:		main(int argc, char *argv[])
 //
 // Title:			Main Amortization
 //
@@ -26,7 +66,40 @@
 //					monthly payment and number of months making payment.
 //					Users choose 5 to exit. Especially, at the end of every 
 //					option from 1 to 4, user can choose yes or no to print 
-//					the table of payment each month
+//					the table of payment each month.
+//					When it is started as "Projectcs131-3 input output
+//					[threads]" it runs in batch mode instead: every line of
+//					the input file "mode,apr,principal,payment,months" is
+//					calculated like the matching menu option, on every
+//					processor unless threads is given, and written to the
+//					output file in input order.
+//					Started as "Projectcs131-3 --cents" the amortization
+//					tables are calculated in whole cents instead of doubles.
+//					Started as "Projectcs131-3 --serve address [threads]"
+//					it answers the batch lines, and "S" lines asking for a
+//					whole table, over a Unix ("unix:path") or TCP
+//					("host:port") socket until it is interrupted.
+//					Started as "Projectcs131-3 --portfolio input output
+//					[total|apr|term] [width] [threads]" it adds up the
+//					monthly cash flows of every loan in the input file,
+//					in total and by APR band or term band.
+//					Started as "Projectcs131-3 --ratesheet output
+//					[principal] [maxApr] [text|binary] [threads]" it
+//					writes the payment on principal (default $1000) for
+//					every APR eighth up to maxApr (default 30) and every
+//					term from 1 to 360 months.
+//					Started as "Projectcs131-3 --scan output principal
+//					apr periods [periodsPerYear] [threads]" it writes the
+//					whole-cent table of a loan of any length paid
+//					periodsPerYear times a year (default 12), with the
+//					balances built on every core by a prefix scan.
+//					Started as "Projectcs131-3 --schedules input output
+//					[cents]" it writes the whole table of every loan in
+//					the input file to a binary schedule file, in whole
+//					cents when "cents" is given.
+//					Any of these may start with "--stats text" or
+//					"--stats json" to write the call counts, latency
+//					percentiles and solver steps to stderr at the end
 // Programmer:		Son Minh Tran
 // 
 // Date:			03/04/2017
@@ -43,17 +116,23 @@
 //					Exit the program if choose 5
 //					
 //
-//	Parameters:		void
+//	Parameters:		argc	(int)
+//					argv	(char*[])
 //  Returns:		EXIT_SUCCESS for successful completion 
 //					Or EXIT_FAILURE when the program cannot read the 
 //					data file and output file
 // Called By:		None
-// Calls:			readApr()
+// Calls:			initGrowthTable()
+//					initStats()
+//					dumpStats()
+//					clearScreen()
+//					printMenu()
+//					readApr()
 //					readPrincipal()
 //					readMonth()
 //					readPayment()
-//					getPaymentAmount(int months, double principal,
-//									double monthlyRate)
+//					getSchedulePayment(int months, double principal,
+//									double monthlyRate, int arithmetic)
 //					getLoanAmount(int months, double totalPayment, 
 //									double monthlyRate)
 //					getNumberOfMonths(double principal, double totalPayment,
@@ -61,14 +140,43 @@
 //					getInterestRate(double sizeOfLoan, double monthlyPayment, 
 //									int months)
 //					printTable(double principal, double payment, 
-//									double monthlyRate, int month)
+//									double monthlyRate, int month,
+//									int arithmetic)
+//					runBatchFile(const char* inName, const char* outName,
+//									int threadCount)
+//					runServer(const char* address, int threadCount)
+//					runPortfolioFile(const char* inName,
+//									const char* outName, int bucketing,
+//									int bucketWidth, int threadCount)
+//					runRateSheet(const char* outName, double principal,
+//									double maxApr, int format,
+//									int threadCount)
+//					runScanSchedule(const char* outName,
+//									double principal, double apr,
+//									int periods, int periodsPerYear,
+//									int threadCount)
+//					runScheduleFile(const char* inName,
+//									const char* outName, int arithmetic)
 //
 // History Log:		Commit github on 01/24/2017: initialize the project
 //					Commit github on 01/25/2017: 
 //					Commit github on 02/04/2017: 
 //					Commit github on 02/08/2017: 
+//					10/17/2026: batch mode from a file
+//					10/17/2026: batch thread count
+//					10/17/2026: growth factor table
+//					10/17/2026: --cents for whole-cent tables
+//					10/17/2026: console I/O from AmortConsole.c
+//					10/17/2026: --serve for the pricing server
+//					10/17/2026: --portfolio for monthly cash flows
+//					10/17/2026: --stats for the instrumentation
+//					10/17/2026: --ratesheet for payment matrices
+//					10/17/2026: --scan for long schedules
+//					10/17/2026: --schedules for binary schedule files
+//					10/17/2026: payment from getSchedulePayment()
+//					10/17/2026: arithmetic kept here, not in the library
 //----------------------------------------------------------------------------
-int main(void) {
+int main(int argc, char *argv[]) {
 	short again = TRUE;
 	double totalPayment = 0.0;
 	double principal = 0.0;
@@ -78,11 +186,76 @@ int main(void) {
 	double monthlyRate = 0.0;
 	double apr = 0.0;
 	int initialGuessMonth = 0;
+	int bucketing = 0;
+	//"--cents" and "--schedules ... cents" choose whole-cent tables
+	int arithmetic = ARITHMETIC_DOUBLE;
 
+	initGrowthTable();
+	if (argc >= 3 && strcmp(argv[1], "--stats") == 0)
+	{
+		statsFormat = strcmp(argv[2], "json") == 0 ? STATS_JSON : STATS_TEXT;
+		initStats();
+		atexit(dumpStats);
+		argv[2] = argv[0];
+		argv += 2;
+		argc -= 2;
+	}
+	if (argc >= 3 && strcmp(argv[1], "--serve") == 0)
+	{
+		return runServer(argv[2], argc >= 4 ? atoi(argv[3]) : 0);
+	}
+	if (argc >= 4 && strcmp(argv[1], "--portfolio") == 0)
+	{
+		bucketing = PORTFOLIO_TOTAL;
+		if (argc >= 5 && strcmp(argv[4], "apr") == 0)
+		{
+			bucketing = PORTFOLIO_BY_APR;
+		}
+		else if (argc >= 5 && strcmp(argv[4], "term") == 0)
+		{
+			bucketing = PORTFOLIO_BY_TERM;
+		}
+		return runPortfolioFile(argv[2], argv[3], bucketing,
+			argc >= 6 ? atoi(argv[5]) :
+			bucketing == PORTFOLIO_BY_APR ? APR_BAND : TERM_BAND,
+			argc >= 7 ? atoi(argv[6]) : 0);
+	}
+	if (argc >= 3 && strcmp(argv[1], "--ratesheet") == 0)
+	{
+		return runRateSheet(argv[2],
+			argc >= 4 ? atof(argv[3]) : SHEET_PRINCIPAL,
+			argc >= 5 ? atof(argv[4]) : SHEET_MAX_APR,
+			argc >= 6 && strcmp(argv[5], "binary") == 0 ?
+			SHEET_BINARY : SHEET_TEXT,
+			argc >= 7 ? atoi(argv[6]) : 0);
+	}
+	if (argc >= 6 && strcmp(argv[1], "--scan") == 0)
+	{
+		return runScanSchedule(argv[2], atof(argv[3]), atof(argv[4]),
+			atoi(argv[5]), argc >= 7 ? atoi(argv[6]) : SCAN_PERIODS_PER_YEAR,
+			argc >= 8 ? atoi(argv[7]) : 0);
+	}
+	if (argc >= 4 && strcmp(argv[1], "--schedules") == 0)
+	{
+		if (argc >= 5 && strcmp(argv[4], "cents") == 0)
+		{
+			arithmetic = ARITHMETIC_CENTS;
+		}
+		return runScheduleFile(argv[2], argv[3], arithmetic);
+	}
+	if (argc == 2 && strcmp(argv[1], "--cents") == 0)
+	{
+		arithmetic = ARITHMETIC_CENTS;
+	}
+	else if (argc >= 3)
+	{
+		return runBatchFile(argv[1], argv[2],
+			argc >= 4 ? atoi(argv[3]) : 0);
+	}
 	do
 	{
 		//clean and print menu to console
-		system("cls");
+		clearScreen();
 		printMenu();
 		switch (getche())
 		{
@@ -98,12 +271,13 @@ int main(void) {
 				//read the month
 				month = readMonth();
 				//calculate the payment each month
-				totalPayment = getPaymentAmount(month, 
-					principal, monthlyRate);
+				totalPayment = getSchedulePayment(month,
+					principal, monthlyRate, arithmetic);
 				//print out the payment for each month
 				printf("\nPayment: $%.2lf per month", totalPayment);
 				//print table or not depend on user choice
-				printTable(principal, totalPayment, monthlyRate, month);
+				printTable(principal, totalPayment, monthlyRate, month,
+					arithmetic);
 				break;
 			case '2':
 			case 'l':
@@ -121,7 +295,8 @@ int main(void) {
 				//print out the loan size
 				printf("\nLoan Amount: $%.2lf", principal);
 				//print out the table of loan depend on user choice
-				printTable(principal, totalPayment, monthlyRate, month);
+				printTable(principal, totalPayment, monthlyRate, month,
+					arithmetic);
 				break;
 			case '3':
 			case 'N':
@@ -154,7 +329,8 @@ int main(void) {
 				//print out the month
 				printf("\nNumber of months to pay the loan: %d", month);
 				//print the table if user choose y
-				printTable(principal, totalPayment, monthlyRate, month);
+				printTable(principal, totalPayment, monthlyRate, month,
+					arithmetic);
 				break;
 			case '4':
 			case 'I':
@@ -183,7 +359,8 @@ int main(void) {
 				//print out the apr
 				printf("\nAnnual Percentage Rate: %.3lf%c", apr, '%');
 				//print the table if user choose y
-				printTable(principal, totalPayment, monthlyRate, month);
+				printTable(principal, totalPayment, monthlyRate, month,
+					arithmetic);
 				break;
 			case '5':
 			case 'Q':
@@ -192,7 +369,7 @@ int main(void) {
 				return EXIT_SUCCESS;
 			default:
 				//clean and print the menu
-				system("cls");
+				clearScreen();
 				printMenu();
 				again = TRUE;
 				break;